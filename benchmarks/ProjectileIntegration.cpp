@@ -0,0 +1,137 @@
+/**
+ * Micro-benchmark for projectile integration. Compares the old object per projectile update, which recomputed the
+ * velocity and queried the renderer's output size for every projectile, against the batch kernels in
+ * ProjectileBatch.
+ *
+ * Usage: CoffeeMakerBenchmarks [numProjectiles] [numFrames]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Game/ProjectileBatch.hpp"
+
+namespace {
+  constexpr float OUTPUT_WIDTH = 2560.0f;
+  constexpr float OUTPUT_HEIGHT = 1440.0f;
+  constexpr float DELTA_TIME = 1.0f / 144.0f;
+
+  // NOTE: stand ins for Renderer::GetOutputWidth/Height and DynamicResolutionDownScale, kept out of line like the
+  // real ones which live in another translation unit.
+#if defined(_MSC_VER)
+#define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+  BENCHMARK_NOINLINE int GetOutputWidth() { return static_cast<int>(OUTPUT_WIDTH); }
+  BENCHMARK_NOINLINE int GetOutputHeight() { return static_cast<int>(OUTPUT_HEIGHT); }
+  BENCHMARK_NOINLINE float DynamicResolutionDownScale() { return GetOutputWidth() / 1792.0f; }
+
+  /**
+   * Mirrors the per object Projectile::Update path.
+   */
+  struct ObjectProjectile {
+    float x, y, w, h;
+    float movementX, movementY;
+    float speed;
+    bool fired;
+
+    void Update(float deltaTime) {
+      if (fired) {
+        x += movementX * speed * DynamicResolutionDownScale() * deltaTime;
+        y += movementY * speed * DynamicResolutionDownScale() * deltaTime;
+        if (x + w <= 0 || x >= GetOutputWidth() || y + h <= 0 || y >= GetOutputHeight()) {
+          fired = false;
+        }
+      }
+    }
+  };
+
+  struct Spawn {
+    float x, y, dirX, dirY;
+  };
+
+  template <typename F>
+  double TimeFrames(int frames, F&& frame) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+      frame();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+  }
+
+  void Report(const std::string& name, double nanoseconds, size_t projectiles, int frames, size_t alive) {
+    std::cout << name << ": " << nanoseconds / frames / 1000.0 << " us/frame, "
+              << nanoseconds / (static_cast<double>(projectiles) * frames) << " ns/projectile, " << alive
+              << " alive after run\n";
+  }
+}  // namespace
+
+int main(int argc, char** argv) {
+  const size_t count = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 4096;
+  const int frames = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+  std::mt19937 engine(1337);
+  std::uniform_real_distribution<float> positionX(0.0f, OUTPUT_WIDTH);
+  std::uniform_real_distribution<float> positionY(0.0f, OUTPUT_HEIGHT);
+  std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+  std::vector<Spawn> spawns(count);
+  for (auto& spawn : spawns) {
+    float theta = angle(engine);
+    // NOTE: slow enough that most projectiles stay on screen for the whole run
+    spawn = Spawn{positionX(engine), positionY(engine), std::cos(theta) * 0.01f, std::sin(theta) * 0.01f};
+  }
+  const float speed = 500.0f;
+
+  std::vector<std::unique_ptr<ObjectProjectile>> objects;
+  for (auto& spawn : spawns) {
+    objects.emplace_back(new ObjectProjectile{spawn.x, spawn.y, 16.0f, 16.0f, spawn.dirX, spawn.dirY, speed, true});
+  }
+  double objectTime = TimeFrames(frames, [&objects] {
+    for (auto& projectile : objects) {
+      projectile->Update(DELTA_TIME);
+    }
+  });
+  size_t objectAlive = static_cast<size_t>(
+      std::count_if(objects.begin(), objects.end(), [](const auto& projectile) { return projectile->fired; }));
+
+  auto runBatch = [&](void (*integrate)(float*, float*, const float*, const float*, std::uint8_t*, size_t, float,
+                                         const ProjectileBatch::Bounds&),
+                      size_t& alive) {
+    std::vector<float> x(count), y(count), velocityX(count), velocityY(count);
+    std::vector<std::uint8_t> flags(count, 1);
+    const float scaledSpeed = speed * DynamicResolutionDownScale();
+    for (size_t i = 0; i < count; i++) {
+      x[i] = spawns[i].x;
+      y[i] = spawns[i].y;
+      velocityX[i] = spawns[i].dirX * scaledSpeed;
+      velocityY[i] = spawns[i].dirY * scaledSpeed;
+    }
+    ProjectileBatch::Bounds bounds{16.0f, 16.0f, OUTPUT_WIDTH, OUTPUT_HEIGHT};
+    double time = TimeFrames(frames, [&] {
+      integrate(x.data(), y.data(), velocityX.data(), velocityY.data(), flags.data(), count, DELTA_TIME, bounds);
+    });
+    alive = static_cast<size_t>(std::count(flags.begin(), flags.end(), 1));
+    return time;
+  };
+
+  size_t scalarAlive = 0;
+  size_t batchAlive = 0;
+  double scalarTime = runBatch(&ProjectileBatch::IntegrateScalar, scalarAlive);
+  double batchTime = runBatch(&ProjectileBatch::Integrate, batchAlive);
+
+  std::cout << "Projectile integration, " << count << " projectiles, " << frames << " frames\n";
+  Report("Per object", objectTime, count, frames, objectAlive);
+  Report("Batch scalar", scalarTime, count, frames, scalarAlive);
+  Report(std::string("Batch ") + ProjectileBatch::InstructionSet(), batchTime, count, frames, batchAlive);
+  std::cout << "Speed up over per object: " << objectTime / batchTime << "x\n";
+  return 0;
+}
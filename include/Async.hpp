@@ -10,7 +10,9 @@
 #include <thread>
 
 #include "Logger.hpp"
+#include "ThreadPool.hpp"
 #include "Timer.hpp"
+#include "TimerWheel.hpp"
 #include "Utilities.hpp"
 
 namespace CoffeeMaker {
@@ -25,7 +27,7 @@ namespace CoffeeMaker {
     using Function = std::function<T(Args... args)>;
 
     /**
-     * @brief Basic Async Task utility that wraps std::packaged_task
+     * @brief Basic Async Task utility that wraps std::packaged_task, the task runs on the engine ThreadPool.
      *
      * @tparam T
      * @tparam Args
@@ -36,16 +38,11 @@ namespace CoffeeMaker {
     template <typename T, typename... Args>
     class Task<T(Args...)> {
       public:
-      explicit Task(std::function<T(Args...)> fp) : _value(nullptr) {
-        _packagedTask = new std::packaged_task<T(Args...)>(fp);
-        _future = _packagedTask->get_future();
-        _thread = new std::thread(std::move(*_packagedTask));
+      explicit Task(std::function<T(Args...)> fp) : _waited(false), _value() {
+        _future = ThreadPool::Instance()->Enqueue(std::move(fp));
       }
 
-      ~Task() {
-        Wait();
-        delete _packagedTask;
-      }
+      ~Task() { Wait(); }
 
       /**
        * @brief Blocks the calling thread until the task completes its work.
@@ -53,10 +50,9 @@ namespace CoffeeMaker {
        * @return Task*
        */
       Task* Wait() {
-        if (_thread != nullptr && _thread->joinable()) {
-          _thread->join();
-          delete _thread;
-          _thread = nullptr;
+        if (!_waited) {
+          ThreadPool::Instance()->Wait(_future);
+          _waited = true;
           _value = _future.get();
         }
         return this;
@@ -70,14 +66,13 @@ namespace CoffeeMaker {
       T Get() { return _value; }
 
       private:
-      std::packaged_task<T(Args...)>* _packagedTask;
       std::future<T> _future;
-      std::thread* _thread;
+      bool _waited;
       T _value;
     };
 
     /**
-     * @brief Runs a given Function on another thread
+     * @brief Runs a given Function on the engine ThreadPool
      *
      * @tparam T Return value type of the Function
      * @tparam F Function type
@@ -88,192 +83,118 @@ namespace CoffeeMaker {
      */
     template <typename T, typename F, typename... Args>
     Future<T> Run(F fn, Args&&... args) {
-      return std::async(std::launch::async, fn, std::forward<Args&&>(args)...);
+      return ThreadPool::Instance()->Enqueue(std::move(fn), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Calls body(first, last) on the engine ThreadPool over [begin, end) in chunks of at most grain indices
+     * and blocks until all of them are done.
+     */
+    inline void ParallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body) {
+      ThreadPool::Instance()->ParallelFor(begin, end, grain, body);
     }
 
+    /**
+     * @brief One shot timeout scheduled on the engine TimerWheel. The callback is invoked on the main thread
+     * while the wheel is serviced by the main loop.
+     */
     class TimeoutTask {
       public:
       TimeoutTask(const std::string& name, std::function<void(void)> cb, int duration) :
-          _callback(cb),
-          _name(name),
-          _running(false),
-          _timer(CreateScope<CoffeeMaker::StopWatch>(duration)),
-          _thread(nullptr),
-          _shouldKill(false) {
-        _timeoutMutex = new std::mutex();
-      }
+          _name(name), _duration(static_cast<Uint32>(duration)), _remaining(0), _paused(false), _node(cb) {}
       TimeoutTask(std::function<void(void)> cb, int duration) :
-          _callback(cb),
           _name("UNKNOWN_TIMEOUT_TASK"),
-          _running(false),
-          _timer(CreateScope<CoffeeMaker::StopWatch>(duration)),
-          _thread(nullptr),
-          _shouldKill(false) {
-        _timeoutMutex = new std::mutex();
-      }
+          _duration(static_cast<Uint32>(duration)),
+          _remaining(0),
+          _paused(false),
+          _node(cb) {}
 
-      ~TimeoutTask() {
-        Cancel();
-        if (_future.valid()) {
-          _future.get();
-        }
-        if (_thread != nullptr && _thread->joinable()) {
-          _thread->join();
-          delete _thread;
-          _thread = nullptr;
-        }
-        delete _timeoutMutex;
-      }
+      ~TimeoutTask() { Cancel(); }
 
       void Start() {
-        if (!_running) {
-          _running = true;
-          _canceled = false;
-          if (_shouldKill) {
-            // CM_LOGGER_DEBUG("{} thread will be killed", _name);
-            _thread->join();
-            delete _thread;
-            // CM_LOGGER_DEBUG("{} thread was killed", _name);
-          } else {
-            // CM_LOGGER_DEBUG("{} thread was NOT killed", _name);
-          }
-          // CM_LOGGER_DEBUG("{} thread was created", _name);
-          _thread = new std::thread([this] {
-            _shouldKill = false;
-            _timer->Start();
-            while (!_canceled) {
-              std::this_thread::sleep_for(std::chrono::milliseconds(16));
-              std::lock_guard<std::mutex> lk(*_timeoutMutex);
-              if (_timer->Expired()) {
-                _callback();
-                _running = false;
-                _shouldKill = true;
-                return;
-              }
-            }
-            _running = false;
-            _shouldKill = true;
-            return;
-          });
+        if (!_node.IsScheduled() && !_paused) {
+          TimerWheel::Instance()->Schedule(&_node, _duration);
         }
       }
 
-      void Reset() {
-        _canceled = false;
-        _running = false;
-      }
+      void Reset() { Cancel(); }
 
       void Cancel() {
-        std::lock_guard<std::mutex> lk(*_timeoutMutex);
-        _canceled = true;
-        CoffeeMaker::Logger::Trace("[TIMEOUT][{}] Canceled at {}", _name, _timer->GetTicks());
+        TimerWheel::Instance()->Cancel(&_node);
+        _paused = false;
+        CoffeeMaker::Logger::Trace("[TIMEOUT][{}] Canceled", _name);
       }
 
       void Pause() {
-        std::lock_guard<std::mutex> lk(*_timeoutMutex);
-        _timer->Pause();
-        CoffeeMaker::Logger::Trace("[TIMEOUT][{}] Paused at {}", _name, _timer->GetTicks());
+        if (_node.IsScheduled()) {
+          _remaining = TimerWheel::Instance()->Remaining(&_node);
+          TimerWheel::Instance()->Cancel(&_node);
+          _paused = true;
+          CoffeeMaker::Logger::Trace("[TIMEOUT][{}] Paused with {} remaining", _name, _remaining);
+        }
       }
 
       void Unpause() {
-        std::lock_guard<std::mutex> lk(*_timeoutMutex);
-        _timer->Unpause();
-        CoffeeMaker::Logger::Trace("[TIMEOUT][{}] Resumed at {}", _name, _timer->GetTicks());
+        if (_paused) {
+          _paused = false;
+          TimerWheel::Instance()->Schedule(&_node, _remaining);
+          CoffeeMaker::Logger::Trace("[TIMEOUT][{}] Resumed with {} remaining", _name, _remaining);
+        }
       }
 
       private:
-      std::function<void(void)> _callback;
       std::string _name;
-      bool _canceled{false};
-      bool _running;
-      std::future<void> _future;
-      Scope<CoffeeMaker::StopWatch> _timer;
-      std::mutex* _timeoutMutex;
-      std::thread* _thread;
-      std::atomic<bool> _shouldKill;
+      Uint32 _duration;
+      Uint32 _remaining;
+      bool _paused;
+      TimerNode _node;
     };
 
+    /**
+     * @brief Repeating interval scheduled on the engine TimerWheel. The callback is invoked on the main thread
+     * every duration milliseconds until the interval is canceled.
+     */
     class IntervalTask {
       public:
       IntervalTask(std::function<void(void)> cb, int duration) :
-          _callback(cb),
-          _canceled(false),
-          _running(false),
-          _timer(CreateScope<CoffeeMaker::StopWatch>(duration)),
-          _mutex(new std::mutex()),
-          _thread(nullptr),
-          _shouldKill(false) {}
+          _duration(static_cast<Uint32>(duration)), _remaining(0), _paused(false), _node(cb) {}
 
-      ~IntervalTask() {
-        Cancel();
-        if (_future.valid()) {
-          _future.get();
-        }
-        if (_thread != nullptr && _thread->joinable()) {
-          _thread->join();
-          delete _thread;
-          _thread = nullptr;
-        }
-        delete _mutex;
-      }
+      ~IntervalTask() { Cancel(); }
 
       void Start() {
-        if (!_running) {
-          _running = true;
-          _canceled = false;
-          if (_shouldKill) {
-            CoffeeMaker::Logger::Trace("{} thread will be killed", "Interval");
-            _thread->join();
-            delete _thread;
-            CoffeeMaker::Logger::Trace("{} thread was killed", "Interval");
-          }
-          CoffeeMaker::Logger::Trace("{} thread was created", "Interval");
-          _thread = new std::thread([this] {
-            _shouldKill = false;
-            _timer->Start();
-            while (!_canceled) {
-              std::this_thread::sleep_for(std::chrono::milliseconds(16));
-              std::lock_guard<std::mutex> lk(*_mutex);
-              if (_timer->Expired()) {
-                _callback();
-                _running = false;
-                _timer->Reset();
-              }
-            }
-            _running = false;
-            _shouldKill = true;
-            return;
-          });
+        if (!_node.IsScheduled() && !_paused) {
+          TimerWheel::Instance()->Schedule(&_node, _duration, _duration);
         }
       }
 
       void Cancel() {
-        std::lock_guard<std::mutex> lk(*_mutex);
-        _canceled = true;
-        CoffeeMaker::Logger::Trace("[INTERVAL][undefined] Resumed at {}", _timer->GetTicks());
+        TimerWheel::Instance()->Cancel(&_node);
+        _paused = false;
+        CoffeeMaker::Logger::Trace("[INTERVAL][undefined] Canceled");
       }
 
       void Pause() {
-        std::lock_guard<std::mutex> lk(*_mutex);
-        _timer->Pause();
-        CoffeeMaker::Logger::Trace("[INTERVAL][undefined] Resumed at {}", _timer->GetTicks());
+        if (_node.IsScheduled()) {
+          _remaining = TimerWheel::Instance()->Remaining(&_node);
+          TimerWheel::Instance()->Cancel(&_node);
+          _paused = true;
+          CoffeeMaker::Logger::Trace("[INTERVAL][undefined] Paused with {} remaining", _remaining);
+        }
       }
 
       void Unpause() {
-        std::lock_guard<std::mutex> lk(*_mutex);
-        _timer->Unpause();
-        CoffeeMaker::Logger::Trace("[INTERVAL][undefined] Resumed at {}", _timer->GetTicks());
+        if (_paused) {
+          _paused = false;
+          TimerWheel::Instance()->Schedule(&_node, _remaining, _duration);
+          CoffeeMaker::Logger::Trace("[INTERVAL][undefined] Resumed with {} remaining", _remaining);
+        }
       }
 
       private:
-      std::function<void(void)> _callback;
-      bool _canceled;
-      bool _running;
-      std::future<void> _future;
-      Scope<CoffeeMaker::StopWatch> _timer;
-      std::mutex* _mutex;
-      std::thread* _thread;
-      std::atomic<bool> _shouldKill;
+      Uint32 _duration;
+      Uint32 _remaining;
+      bool _paused;
+      TimerNode _node;
     };
   }  // namespace Async
 }  // namespace CoffeeMaker
@@ -0,0 +1,117 @@
+#ifndef _coffeemaker_bakedspline_hpp
+#define _coffeemaker_bakedspline_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Math.hpp"
+
+namespace CoffeeMaker {
+  /**
+   * @brief Arc length table of a BSpline that never changes once it is baked, so any number of animations can
+   * follow the same curve at once. Instead of moving control points, every follower anchors the ends of the curve
+   * where it needs them with offsets applied at sample time.
+   */
+  class BakedSpline {
+    public:
+    BakedSpline() = default;
+    /**
+     * @param points samples of the curve at evenly spaced knots
+     * @param lengths distance travelled along the curve up to every sample
+     */
+    BakedSpline(std::vector<CoffeeMaker::Math::Point2D> points, std::vector<float> lengths);
+
+    /**
+     * @brief Distance travelled along a polyline up to every one of its points.
+     */
+    static std::vector<float> ArcLengths(const std::vector<CoffeeMaker::Math::Point2D>& points);
+
+    /**
+     * @brief Returns the Point2D a given fraction of the way along the curve, see BSpline::Point2DAtDistance.
+     * The ends of the curve are moved by the start and end offsets, the points in between by a blend of the two
+     * weighted by distance.
+     * @param fraction float value clamped between 0.0 and 1.0
+     * @return CoffeeMaker::Math::Point2D
+     */
+    CoffeeMaker::Math::Point2D Point2DAtDistance(float fraction,
+                                                 const CoffeeMaker::Math::Point2D& startOffset = {0.0f, 0.0f},
+                                                 const CoffeeMaker::Math::Point2D& endOffset = {0.0f, 0.0f}) const;
+
+    CoffeeMaker::Math::Point2D First() const;
+    CoffeeMaker::Math::Point2D Last() const;
+    float Length() const;
+    bool Empty() const;
+
+    /**
+     * @brief Returns a horizontally inverted copy, as if it was baked from BSpline::InvertControlPoints.
+     *
+     * @param width of the space the curve is inverted in
+     * @return BakedSpline
+     */
+    BakedSpline Invert(float width) const;
+
+    /**
+     * @brief Returns a copy stretched by sx horizontally and sy vertically, as if it was baked from control points
+     * stretched the same way. The lengths are scaled along when the stretch is uniform and measured again when it
+     * is not.
+     *
+     * @return BakedSpline
+     */
+    BakedSpline Scale(float sx, float sy) const;
+
+    const std::vector<CoffeeMaker::Math::Point2D>& Points() const { return _points; }
+    const std::vector<float>& Lengths() const { return _lengths; }
+
+    private:
+    std::vector<CoffeeMaker::Math::Point2D> _points;
+    std::vector<float> _lengths;
+  };
+
+  /**
+   * @brief Contents of a .bspline file, the binary twin of a .spline asset baked at build time by the
+   * CoffeeMakerSplineBaker tool. Holds the control points and knots the curve was made from along with its arc
+   * length table, so loading one is a copy out of a memory mapped file instead of parsing text and evaluating the
+   * curve.
+   *
+   * Layout, little endian: a Header followed by float arrays of the control points (x, y), the knots, the samples
+   * (x, y) and their lengths. Everything is in the space the .spline was authored in, see AUTHORED_WIDTH.
+   */
+  struct SplineAsset {
+    struct Header {
+      char magic[4];
+      std::uint32_t version;
+      std::uint32_t numControlPoints;
+      std::uint32_t numKnots;
+      std::uint32_t numSamples;
+    };
+
+    static constexpr char MAGIC[4] = {'C', 'M', 'B', 'S'};
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr const char* EXTENSION = ".bspline";
+    /**
+     * @brief Size of the screen .spline assets are authored for, see BSpline::RemapControlPoints
+     */
+    static constexpr float AUTHORED_WIDTH = 2560.0f;
+    static constexpr float AUTHORED_HEIGHT = 1440.0f;
+
+    std::vector<CoffeeMaker::Math::Point2D> controlPoints;
+    std::vector<float> knots;
+    BakedSpline path;
+
+    /**
+     * @return the bytes of a .bspline file
+     */
+    std::string Encode() const;
+    /**
+     * @brief Reads a .bspline file out of memory.
+     *
+     * @return false if the data is not a .bspline file of this VERSION, or its size does not match the counts in its
+     * header, asset is left untouched
+     */
+    static bool Decode(const char* data, size_t size, SplineAsset& asset);
+  };
+}  // namespace CoffeeMaker
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef _coffeemaker_benchmark_hpp
+#define _coffeemaker_benchmark_hpp
+
+#include <SDL2/SDL.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief Summary of a series of per frame samples.
+   */
+  struct BenchmarkStats {
+    double mean;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+  };
+
+  /**
+   * @brief Records a fixed number of frames of the game loop and reports them as JSON.
+   *
+   * The main loop marks the start and end of each frame, and of the update, physics and render stages within it.
+   * Stages can be entered several times a frame, ie: once per simulation step, their times are summed.
+   */
+  class Benchmark {
+    public:
+    enum class Stage { Update = 0, Physics, Render };
+    static constexpr size_t NUM_STAGES = 3;
+    /**
+     * @brief Seed for Math::RandomEngine so every run plays out the same.
+     */
+    static constexpr unsigned int SEED = 1985;
+
+    Benchmark(const std::string& scene, int frames, double tickRate);
+
+    /**
+     * @brief True until the requested number of frames has been recorded.
+     */
+    bool Running() const;
+    /**
+     * @brief Index of the frame being recorded.
+     */
+    int Frame() const;
+    /**
+     * @brief Simulated time in milliseconds at the start of the current frame. Each frame runs exactly one step.
+     */
+    Uint32 SimulatedTicks() const;
+
+    void BeginFrame();
+    /**
+     * @brief Closes the current frame.
+     *
+     * @param drawCalls draw calls issued by the renderer this frame
+     */
+    void EndFrame(Uint32 drawCalls);
+    void BeginStage(Stage stage);
+    void EndStage(Stage stage);
+    /**
+     * @brief Milliseconds spent in the stage, one sample per recorded frame.
+     */
+    const std::vector<double>& StageTimes(Stage stage) const;
+
+    /**
+     * @brief Feeds the keyboard input for the current frame into the InputManager. The player strafes back and
+     * forth across the screen while firing, the same way on every run.
+     */
+    void ScriptInput() const;
+
+    std::string ToJson() const;
+
+    /**
+     * @brief Nearest rank percentile of an ascending list of samples, 0 if there are none.
+     *
+     * @param sorted
+     * @param percentile in [0, 100]
+     */
+    static double Percentile(const std::vector<double>& sorted, double percentile);
+    static BenchmarkStats Summarize(std::vector<double> samples);
+
+    private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int SWEEP_FRAMES = 180;
+    static constexpr int FIRE_FRAMES = 20;
+
+    static void Key(SDL_Scancode scanCode, bool down);
+    static double Milliseconds(Clock::time_point start, Clock::time_point end);
+
+    std::string _scene;
+    int _frames;
+    double _tickRate;
+    Clock::time_point _frameStart;
+    std::array<Clock::time_point, NUM_STAGES> _stageStart;
+    std::array<double, NUM_STAGES> _stageTime;
+    std::uint64_t _frameAllocations;
+    std::vector<double> _frameTimes;
+    std::array<std::vector<double>, NUM_STAGES> _stageTimes;
+    std::vector<double> _drawCalls;
+    std::vector<double> _allocations;
+  };
+
+  /**
+   * @brief Times a stage of the current frame for as long as it is in scope. Does nothing without a benchmark.
+   */
+  class BenchmarkStage {
+    public:
+    BenchmarkStage(Benchmark* benchmark, Benchmark::Stage stage);
+    ~BenchmarkStage();
+
+    private:
+    Benchmark* _benchmark;
+    Benchmark::Stage _stage;
+  };
+
+}  // namespace CoffeeMaker
+
+#endif
@@ -3,13 +3,16 @@
 
 #include <SDL2/SDL.h>
 
-#include <chrono>
-#include <iostream>
-#include <sstream>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
 #include <string>
-#include <thread>
 
+#include "CoroutineScheduler.hpp"
+#include "Executor.hpp"
 #include "File.hpp"
+#include "ThreadPool.hpp"
+#include "TimerWheel.hpp"
 
 #ifdef COROUTINE_SUPPORT
 #include <coroutine>
@@ -66,116 +69,115 @@ namespace CoffeeMaker {
     virtual ReturnType await_resume() = 0;
   };
 
-  class Awaiter : public IAwaiter<int> {
-    public:
-    bool await_ready() override { return false; }
-    void await_suspend(std::coroutine_handle<Coroutine::promise_type> handle) override {
-      std::thread([handle] {
-        // do expensive task...
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        std::cout << "await resuming" << std::endl;
-        handle.resume();
-      }).detach();
-    }
-    int await_resume() override {
-      std::cout << "resumed" << std::endl;
-      return 4;
-    }
-  };
-
+  /**
+   * @brief Suspends for duration milliseconds of engine time. The wait is kept on the engine TimerWheel, so it
+   * stops while the game is paused, and the coroutine is resumed on the main thread. Clearing the scheduler cancels
+   * the wait, see AsyncWait.
+   */
   class TimeoutAwaiter : public IAwaiter<void> {
     public:
-    explicit TimeoutAwaiter(int duration) : _clockStart(std::chrono::steady_clock::now()), _duration(duration) {}
+    explicit TimeoutAwaiter(int duration, CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+        _duration(static_cast<Uint32>(std::max(duration, 0))),
+        _scheduler(scheduler),
+        _wait(),
+        _node([this] { Async::Executor::Instance()->Post([wait = _wait] { wait->Resume(); }); }) {}
+    TimeoutAwaiter(const TimeoutAwaiter&) = delete;
+    TimeoutAwaiter& operator=(const TimeoutAwaiter&) = delete;
     ~TimeoutAwaiter() = default;
 
     bool await_ready() override { return false; }
     void await_suspend(std::coroutine_handle<Coroutine::promise_type> handle) override {
-      std::thread([handle, this] {
-        while (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _clockStart)
-                   .count() < _duration) {
-          std::this_thread::sleep_for(std::chrono::milliseconds(16));
-        }
-        handle.resume();
-      }).detach();
+      _wait = AsyncWait::Start(_scheduler, ScriptHandle::From(handle));
+      Async::TimerWheel::Instance()->Schedule(&_node, _duration);
     }
     void await_resume() override {}
 
     private:
-    std::chrono::steady_clock::time_point _clockStart;
-    int _duration;
+    Uint32 _duration;
+    CoroutineScheduler* _scheduler;
+    std::shared_ptr<AsyncWait> _wait;
+    // NOTE: canceled when the awaiter goes away with its coroutine
+    Async::TimerNode _node;
   };
 
+  /**
+   * @brief co_await Delay(500) resumes the coroutine on the main thread 500ms of engine time later.
+   */
+  inline TimeoutAwaiter Delay(int milliseconds) { return TimeoutAwaiter{milliseconds}; }
+
   class HttpAwaiter;
 
+  /**
+   * @brief Reads the file on the ThreadPool and resumes the coroutine on the main thread. Clearing the scheduler
+   * cancels the wait, the file that was read is then freed.
+   */
   class ReadFileAwaiter : public IAwaiter<CoffeeMaker::File> {
     public:
-    explicit ReadFileAwaiter(const std::string& fileName) :
-        _fileName(fileName), _file(CoffeeMaker::File{.name = fileName, .loaded = false, .data = nullptr}) {}
+    explicit ReadFileAwaiter(const std::string& fileName,
+                             CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+        _state(std::make_shared<State>()), _scheduler(scheduler) {
+      _state->fileName = fileName;
+      _state->file = CoffeeMaker::File{.name = fileName, .loaded = false, .data = nullptr};
+    }
     ~ReadFileAwaiter() {}
 
     bool await_ready() override { return false; }
     void await_suspend(std::coroutine_handle<Coroutine::promise_type> handle) override {
-      std::thread([handle, this] {
-        SDL_RWops* file = SDL_RWFromFile(_fileName.c_str(), "r");
-        if (file == NULL) {
-          handle.resume();
-          return;
-        }
-        Sint64 resultSize = SDL_RWsize(file);
-        _file.data = (char*)malloc(resultSize + 1);
-        char* buf = _file.data;
-        Sint64 nb_read_total = 0;
-        Sint64 nb_read = 1;
-        while (nb_read_total < resultSize && nb_read != 0) {
-          nb_read = SDL_RWread(file, buf, 1, resultSize - nb_read_total);
-          nb_read_total += nb_read;
-          buf += nb_read;
-        }
-        SDL_RWclose(file);
-        if (nb_read_total != resultSize) {
-          free(_file.data);
-        }
-        _file.data[nb_read_total] = '\0';
-        _file.loaded = true;
-        handle.resume();
-      }).detach();
+      std::shared_ptr<AsyncWait> wait = AsyncWait::Start(_scheduler, ScriptHandle::From(handle));
+      // NOTE: the job writes to state it shares, the coroutine frame and this awaiter may be gone before it is done
+      Async::ThreadPool::Instance()->Submit([state = _state, wait] {
+        state->file = CoffeeMaker::ReadFile(state->fileName);
+        Async::Executor::Instance()->Post([state, wait] {
+          if (!wait->Resume()) {
+            free(state->file.data);
+          }
+        });
+      });
     }
-    CoffeeMaker::File await_resume() override { return _file; }
+    CoffeeMaker::File await_resume() override { return _state->file; }
 
     private:
-    std::string _fileName;
-    CoffeeMaker::File _file;
+    struct State {
+      std::string fileName;
+      CoffeeMaker::File file;
+    };
+
+    std::shared_ptr<State> _state;
+    CoroutineScheduler* _scheduler;
   };
 
+  /**
+   * @brief Writes the file on the ThreadPool and resumes the coroutine on the main thread. Clearing the scheduler
+   * cancels the wait, not the write.
+   */
   class WriteFileAwaiter : public IAwaiter<bool> {
     public:
-    explicit WriteFileAwaiter(const std::string& fileName, const std::string& data) :
-        _fileName(fileName), _data(data), _result(false) {}
+    explicit WriteFileAwaiter(const std::string& fileName, const std::string& data,
+                              CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+        _state(std::make_shared<State>(State{.fileName = fileName, .data = data, .result = false})),
+        _scheduler(scheduler) {}
     ~WriteFileAwaiter() {}
 
     bool await_ready() override { return false; }
     void await_suspend(std::coroutine_handle<Coroutine::promise_type> handle) override {
-      std::thread([handle, this] {
-        SDL_RWops* file = SDL_RWFromFile(_fileName.c_str(), "w");
-        if (file != NULL) {
-          const char* str = _data.c_str();
-          size_t len = SDL_strlen(str);
-          if (SDL_RWwrite(file, str, 1, len) != len) {
-            _result = false;
-          } else {
-            _result = true;
-          }
-          SDL_RWclose(file);
-        }
-        handle.resume();
-      }).detach();
+      std::shared_ptr<AsyncWait> wait = AsyncWait::Start(_scheduler, ScriptHandle::From(handle));
+      // NOTE: the job writes to state it shares, the coroutine frame and this awaiter may be gone before it is done
+      Async::ThreadPool::Instance()->Submit([state = _state, wait] {
+        state->result = CoffeeMaker::WriteFile(state->fileName, state->data);
+        Async::Executor::Instance()->Post([wait] { wait->Resume(); });
+      });
     }
-    bool await_resume() override { return _result; }
+    bool await_resume() override { return _state->result; }
 
     private:
-    std::string _fileName;
-    std::string _data;
-    bool _result;
+    struct State {
+      std::string fileName;
+      std::string data;
+      bool result;
+    };
+
+    std::shared_ptr<State> _state;
+    CoroutineScheduler* _scheduler;
   };
 }  // namespace CoffeeMaker
 
@@ -238,114 +240,113 @@ namespace CoffeeMaker {
     virtual ReturnType await_resume() = 0;
   };
 
-  class Awaiter {
-    public:
-    bool await_ready() { return false; }
-    void await_suspend(std::experimental::coroutine_handle<Coroutine::promise_type> handle) {
-      std::thread([handle] {
-        // do expensive task...
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        std::cout << "await resuming" << std::endl;
-        static_cast<std::experimental::coroutine_handle<Coroutine::promise_type>>(handle).resume();
-      }).detach();
-    }
-    int await_resume() {
-      std::cout << "resumed" << std::endl;
-      return 4;
-    }
-  };
-
+  /**
+   * @brief Suspends for duration milliseconds of engine time. The wait is kept on the engine TimerWheel, so it
+   * stops while the game is paused, and the coroutine is resumed on the main thread. Clearing the scheduler cancels
+   * the wait, see AsyncWait.
+   */
   class TimeoutAwaiter {
     public:
-    explicit TimeoutAwaiter(int duration) : _clockStart(std::chrono::steady_clock::now()), _duration(duration) {}
+    explicit TimeoutAwaiter(int duration, CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+        _duration(static_cast<Uint32>(std::max(duration, 0))),
+        _scheduler(scheduler),
+        _wait(),
+        _node([this] { Async::Executor::Instance()->Post([wait = _wait] { wait->Resume(); }); }) {}
+    TimeoutAwaiter(const TimeoutAwaiter&) = delete;
+    TimeoutAwaiter& operator=(const TimeoutAwaiter&) = delete;
     ~TimeoutAwaiter() = default;
 
     bool await_ready() { return false; }
     void await_suspend(std::experimental::coroutine_handle<Coroutine::promise_type> handle) {
-      std::thread([this, handle] {
-        while (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _clockStart)
-                   .count() < _duration) {
-          std::this_thread::sleep_for(std::chrono::milliseconds(16));
-        }
-        static_cast<std::experimental::coroutine_handle<Coroutine::promise_type>>(handle).resume();
-      }).detach();
+      _wait = AsyncWait::Start(_scheduler, ScriptHandle::From(handle));
+      Async::TimerWheel::Instance()->Schedule(&_node, _duration);
     }
     void await_resume() {}
 
     private:
-    std::chrono::steady_clock::time_point _clockStart;
-    int _duration;
+    Uint32 _duration;
+    CoroutineScheduler* _scheduler;
+    std::shared_ptr<AsyncWait> _wait;
+    // NOTE: canceled when the awaiter goes away with its coroutine
+    Async::TimerNode _node;
   };
 
+  /**
+   * @brief co_await Delay(500) resumes the coroutine on the main thread 500ms of engine time later.
+   */
+  inline TimeoutAwaiter Delay(int milliseconds) { return TimeoutAwaiter{milliseconds}; }
+
+  /**
+   * @brief Reads the file on the ThreadPool and resumes the coroutine on the main thread. Clearing the scheduler
+   * cancels the wait, the file that was read is then freed.
+   */
   class ReadFileAwaiter : public IAwaiter<CoffeeMaker::File> {
     public:
-    explicit ReadFileAwaiter(const std::string& fileName) :
-        _fileName(fileName), _file(CoffeeMaker::File{.name = fileName, .loaded = false, .data = nullptr}) {}
+    explicit ReadFileAwaiter(const std::string& fileName,
+                             CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+        _state(std::make_shared<State>()), _scheduler(scheduler) {
+      _state->fileName = fileName;
+      _state->file = CoffeeMaker::File{.name = fileName, .loaded = false, .data = nullptr};
+    }
     ~ReadFileAwaiter() {}
 
     bool await_ready() override { return false; }
     void await_suspend(std::experimental::coroutine_handle<Coroutine::promise_type> handle) override {
-      std::thread([handle, this] {
-        SDL_RWops* file = SDL_RWFromFile(_fileName.c_str(), "r");
-        if (file == NULL) {
-          static_cast<std::experimental::coroutine_handle<Coroutine::promise_type>>(handle).resume();
-          return;
-        }
-        Sint64 resultSize = SDL_RWsize(file);
-        _file.data = (char*)malloc(resultSize + 1);
-        char* buf = _file.data;
-        Sint64 nb_read_total = 0;
-        Sint64 nb_read = 1;
-        while (nb_read_total < resultSize && nb_read != 0) {
-          nb_read = SDL_RWread(file, buf, 1, resultSize - nb_read_total);
-          nb_read_total += nb_read;
-          buf += nb_read;
-        }
-        SDL_RWclose(file);
-        if (nb_read_total != resultSize) {
-          free(_file.data);
-        }
-        _file.data[nb_read_total] = '\0';
-        _file.loaded = true;
-        static_cast<std::experimental::coroutine_handle<Coroutine::promise_type>>(handle).resume();
-      }).detach();
+      std::shared_ptr<AsyncWait> wait = AsyncWait::Start(_scheduler, ScriptHandle::From(handle));
+      // NOTE: the job writes to state it shares, the coroutine frame and this awaiter may be gone before it is done
+      Async::ThreadPool::Instance()->Submit([state = _state, wait] {
+        state->file = CoffeeMaker::ReadFile(state->fileName);
+        Async::Executor::Instance()->Post([state, wait] {
+          if (!wait->Resume()) {
+            free(state->file.data);
+          }
+        });
+      });
     }
-    CoffeeMaker::File await_resume() override { return _file; }
+    CoffeeMaker::File await_resume() override { return _state->file; }
 
     private:
-    std::string _fileName;
-    CoffeeMaker::File _file;
+    struct State {
+      std::string fileName;
+      CoffeeMaker::File file;
+    };
+
+    std::shared_ptr<State> _state;
+    CoroutineScheduler* _scheduler;
   };
 
+  /**
+   * @brief Writes the file on the ThreadPool and resumes the coroutine on the main thread. Clearing the scheduler
+   * cancels the wait, not the write.
+   */
   class WriteFileAwaiter : public IAwaiter<bool> {
     public:
-    explicit WriteFileAwaiter(const std::string& fileName, const std::string& data) :
-        _fileName(fileName), _data(data), _result(false) {}
+    explicit WriteFileAwaiter(const std::string& fileName, const std::string& data,
+                              CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+        _state(std::make_shared<State>(State{.fileName = fileName, .data = data, .result = false})),
+        _scheduler(scheduler) {}
     ~WriteFileAwaiter() {}
 
     bool await_ready() override { return false; }
     void await_suspend(std::experimental::coroutine_handle<Coroutine::promise_type> handle) override {
-      std::thread([handle, this] {
-        SDL_RWops* file = SDL_RWFromFile(_fileName.c_str(), "w");
-        if (file != NULL) {
-          const char* str = _data.c_str();
-          size_t len = SDL_strlen(str);
-          if (SDL_RWwrite(file, str, 1, len) != len) {
-            _result = false;
-          } else {
-            _result = true;
-          }
-          SDL_RWclose(file);
-        }
-        static_cast<std::experimental::coroutine_handle<Coroutine::promise_type>>(handle).resume();
-      }).detach();
+      std::shared_ptr<AsyncWait> wait = AsyncWait::Start(_scheduler, ScriptHandle::From(handle));
+      // NOTE: the job writes to state it shares, the coroutine frame and this awaiter may be gone before it is done
+      Async::ThreadPool::Instance()->Submit([state = _state, wait] {
+        state->result = CoffeeMaker::WriteFile(state->fileName, state->data);
+        Async::Executor::Instance()->Post([wait] { wait->Resume(); });
+      });
     }
-    bool await_resume() override { return _result; }
+    bool await_resume() override { return _state->result; }
 
     private:
-    std::string _fileName;
-    std::string _data;
-    bool _result;
+    struct State {
+      std::string fileName;
+      std::string data;
+      bool result;
+    };
+
+    std::shared_ptr<State> _state;
+    CoroutineScheduler* _scheduler;
   };
 }  // namespace CoffeeMaker
 
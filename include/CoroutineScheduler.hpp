@@ -0,0 +1,264 @@
+#ifndef _coffeemaker_coroutinescheduler_hpp
+#define _coffeemaker_coroutinescheduler_hpp
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief A suspended coroutine, stored without knowing its promise type and without allocating.
+   */
+  struct ScriptHandle {
+    void* frame;
+    void (*resume)(void*);
+    void (*destroy)(void*);
+
+    template <typename Handle>
+    static ScriptHandle From(Handle handle) {
+      return ScriptHandle{.frame = handle.address(),
+                          .resume = [](void* frame) { Handle::from_address(frame).resume(); },
+                          .destroy = [](void* frame) { Handle::from_address(frame).destroy(); }};
+    }
+
+    void Resume() const { resume(frame); }
+    void Destroy() const { destroy(frame); }
+  };
+
+  class CoroutineScheduler;
+
+  /**
+   * @brief A script waiting on something outside of its scheduler, ie: a TimerWheel timeout or a ThreadPool job,
+   * that is resumed through the Executor. Whoever finishes the wait keeps the AsyncWait alive and calls Resume on the
+   * main thread, the script is only resumed if its scheduler was not cleared in the meantime.
+   */
+  class AsyncWait {
+    public:
+    /**
+     * @param scheduler clears the wait along with its other scripts, nullptr for a wait that is never canceled
+     */
+    static std::shared_ptr<AsyncWait> Start(CoroutineScheduler* scheduler, ScriptHandle handle);
+
+    AsyncWait(CoroutineScheduler* scheduler, ScriptHandle handle);
+    AsyncWait(const AsyncWait&) = delete;
+    AsyncWait& operator=(const AsyncWait&) = delete;
+
+    /**
+     * @brief Main thread only.
+     *
+     * @return false if the wait was canceled, its script is already destroyed
+     */
+    bool Resume();
+    bool IsCanceled() const;
+
+    private:
+    friend class CoroutineScheduler;
+
+    CoroutineScheduler* _scheduler;
+    ScriptHandle _handle;
+    bool _canceled;
+    bool _resumed;
+  };
+
+  /**
+   * @brief Resumes the gameplay scripts of one scene, every coroutine suspended on an Await:: awaitable.
+   *
+   * Scene time only moves forward in Update while the scheduler is not paused, so a paused scene holds every
+   * frame, timed and condition wait. Event waits are resumed by Dispatch whether paused or not. Everything runs on
+   * the main thread, a waiting script costs its coroutine frame and one entry in a list.
+   */
+  class CoroutineScheduler {
+    public:
+    CoroutineScheduler();
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+    /**
+     * @brief Destroys every script still waiting.
+     */
+    ~CoroutineScheduler();
+
+    void WaitFrame(ScriptHandle handle);
+    /**
+     * @param time scene time in seconds to resume at
+     */
+    void WaitTime(double time, ScriptHandle handle);
+    /**
+     * @brief Resumes the script on the first Update the condition is true.
+     */
+    void WaitCondition(std::function<bool(void)> condition, ScriptHandle handle);
+    /**
+     * @brief Resumes the script on the next dispatched event of the given type. The event is copied to received
+     * before the script is resumed.
+     *
+     * @param target when not nullptr only events whose data1 is target match
+     */
+    void WaitEvent(Uint32 type, void* target, SDL_UserEvent* received, ScriptHandle handle);
+    /**
+     * @brief Tracks a script resumed from outside the scheduler so Clear cancels it, see AsyncWait::Start.
+     */
+    void WaitAsync(const std::shared_ptr<AsyncWait>& wait);
+
+    /**
+     * @brief Advances scene time and resumes every frame wait, every timed wait that is due and every condition
+     * wait that is met, in that order. Scripts waiting on the next frame from within Update wait for the next one.
+     */
+    void Update(float deltaTime);
+    void Dispatch(const SDL_UserEvent& event);
+
+    void Pause();
+    void Unpause();
+    bool IsPaused() const;
+    /**
+     * @brief Seconds of unpaused Updates since the scheduler was created or cleared.
+     */
+    double Time() const;
+    size_t NumWaiting() const;
+
+    /**
+     * @brief Destroys every waiting script and resets scene time, ie: when the scene is destroyed. Safe to call
+     * from a script the scheduler resumed.
+     */
+    void Clear();
+
+    /**
+     * @brief Awaitables created without a scheduler wait on the current one.
+     */
+    void MakeCurrent();
+    static CoroutineScheduler* Current();
+
+    private:
+    friend class AsyncWait;
+
+    struct TimedWait {
+      double time;
+      std::uint64_t order;
+      ScriptHandle handle;
+    };
+    struct ConditionWait {
+      std::function<bool(void)> condition;
+      ScriptHandle handle;
+    };
+    struct EventWait {
+      Uint32 type;
+      void* target;
+      SDL_UserEvent* received;
+      ScriptHandle handle;
+    };
+
+    static bool Later(const TimedWait& a, const TimedWait& b);
+    void ResumeReady();
+    void Forget(const AsyncWait* wait);
+
+    std::vector<ScriptHandle> _frameWaits;
+    std::vector<TimedWait> _timedWaits;
+    std::vector<ConditionWait> _conditionWaits;
+    std::vector<EventWait> _eventWaits;
+    std::vector<std::shared_ptr<AsyncWait>> _asyncWaits;
+    std::vector<ScriptHandle> _ready;
+    size_t _readyIndex;
+    bool _resuming;
+    double _time;
+    std::uint64_t _order;
+    bool _paused;
+
+    static CoroutineScheduler* _current;
+  };
+
+  /**
+   * @brief Awaitables for gameplay scripts, ie: co_await Await::Seconds(2.0f)
+   */
+  namespace Await {
+    class NextFrame {
+      public:
+      explicit NextFrame(CoroutineScheduler* scheduler = CoroutineScheduler::Current()) : _scheduler(scheduler) {}
+
+      bool await_ready() const { return false; }
+      template <typename Handle>
+      void await_suspend(Handle handle) {
+        _scheduler->WaitFrame(ScriptHandle::From(handle));
+      }
+      void await_resume() const {}
+
+      private:
+      CoroutineScheduler* _scheduler;
+    };
+
+    /**
+     * @brief Waits for seconds of scene time, paused time does not count. Zero or less waits for the next frame.
+     */
+    class Seconds {
+      public:
+      explicit Seconds(float seconds, CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+          _seconds(seconds), _scheduler(scheduler) {}
+
+      bool await_ready() const { return false; }
+      template <typename Handle>
+      void await_suspend(Handle handle) {
+        if (_seconds <= 0.0f) {
+          _scheduler->WaitFrame(ScriptHandle::From(handle));
+        } else {
+          _scheduler->WaitTime(_scheduler->Time() + _seconds, ScriptHandle::From(handle));
+        }
+      }
+      void await_resume() const {}
+
+      private:
+      float _seconds;
+      CoroutineScheduler* _scheduler;
+    };
+
+    /**
+     * @brief Waits until the condition is true, checked once per Update. Does not suspend if it already is.
+     */
+    class Until {
+      public:
+      explicit Until(std::function<bool(void)> condition,
+                     CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+          _condition(std::move(condition)), _scheduler(scheduler) {}
+
+      bool await_ready() const { return _condition(); }
+      template <typename Handle>
+      void await_suspend(Handle handle) {
+        _scheduler->WaitCondition(std::move(_condition), ScriptHandle::From(handle));
+      }
+      void await_resume() const {}
+
+      private:
+      std::function<bool(void)> _condition;
+      CoroutineScheduler* _scheduler;
+    };
+
+    /**
+     * @brief Waits for the next user event of the given type, optionally only the ones sent to target through
+     * data1. Resumes with the event.
+     */
+    class Event {
+      public:
+      explicit Event(Uint32 type, void* target = nullptr,
+                     CoroutineScheduler* scheduler = CoroutineScheduler::Current()) :
+          _type(type), _target(target), _scheduler(scheduler), _received{} {}
+
+      bool await_ready() const { return false; }
+      template <typename Handle>
+      void await_suspend(Handle handle) {
+        _scheduler->WaitEvent(_type, _target, &_received, ScriptHandle::From(handle));
+      }
+      SDL_UserEvent await_resume() const { return _received; }
+
+      private:
+      Uint32 _type;
+      void* _target;
+      CoroutineScheduler* _scheduler;
+      SDL_UserEvent _received;
+    };
+  }  // namespace Await
+
+}  // namespace CoffeeMaker
+
+#endif
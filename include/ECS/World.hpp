@@ -0,0 +1,251 @@
+#ifndef _coffeemaker_ecs_world_hpp
+#define _coffeemaker_ecs_world_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace CoffeeMaker {
+  namespace ECS {
+
+    /**
+     * @brief Generational handle to an entity of a World.
+     *
+     * The index of a destroyed entity is reused by the next one created, its generation is bumped so handles to
+     * the destroyed entity stop resolving instead of pointing at whatever took its place.
+     */
+    struct Handle {
+      std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+      std::uint32_t generation = 0;
+
+      bool IsNull() const { return index == std::numeric_limits<std::uint32_t>::max(); }
+      bool operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+      bool operator!=(const Handle& other) const { return !(*this == other); }
+    };
+
+    class IComponentPool {
+      public:
+      virtual ~IComponentPool() = default;
+      virtual void Remove(Handle handle) = 0;
+      virtual void Clear() = 0;
+      virtual size_t Size() const = 0;
+    };
+
+    /**
+     * @brief Components of a single type packed in one array, in no particular order.
+     *
+     * A sparse array maps the entity index to the component's slot, adding and removing are O(1) and removing
+     * moves the last component into the freed slot. References to components are only good until the next
+     * component of the same type is added or removed.
+     */
+    template <typename T>
+    class ComponentPool : public IComponentPool {
+      public:
+      template <typename... Args>
+      T& Add(Handle handle, Args&&... args) {
+        if (handle.index >= _sparse.size()) {
+          _sparse.resize(handle.index + 1, NONE);
+        }
+        std::uint32_t slot = _sparse[handle.index];
+        if (slot != NONE) {
+          // NOTE: a stale handle's component is replaced, as if it had been removed with its entity
+          _handles[slot] = handle;
+          _components[slot] = T{std::forward<Args>(args)...};
+          return _components[slot];
+        }
+        _sparse[handle.index] = static_cast<std::uint32_t>(_components.size());
+        _handles.push_back(handle);
+        _components.push_back(T{std::forward<Args>(args)...});
+        return _components.back();
+      }
+
+      void Remove(Handle handle) override {
+        const std::uint32_t slot = Slot(handle);
+        if (slot == NONE) {
+          return;
+        }
+        const std::uint32_t last = static_cast<std::uint32_t>(_components.size() - 1);
+        if (slot != last) {
+          _components[slot] = std::move(_components[last]);
+          _handles[slot] = _handles[last];
+          _sparse[_handles[slot].index] = slot;
+        }
+        _components.pop_back();
+        _handles.pop_back();
+        _sparse[handle.index] = NONE;
+      }
+
+      void Clear() override {
+        _sparse.clear();
+        _handles.clear();
+        _components.clear();
+      }
+
+      T* Get(Handle handle) {
+        const std::uint32_t slot = Slot(handle);
+        return slot == NONE ? nullptr : &_components[slot];
+      }
+
+      bool Has(Handle handle) const { return Slot(handle) != NONE; }
+      size_t Size() const override { return _components.size(); }
+
+      /**
+       * @brief Owner of every component, handles[i] owns components[i].
+       */
+      const std::vector<Handle>& Handles() const { return _handles; }
+      std::vector<T>& Components() { return _components; }
+
+      private:
+      static constexpr std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+      std::uint32_t Slot(Handle handle) const {
+        if (handle.index >= _sparse.size()) {
+          return NONE;
+        }
+        const std::uint32_t slot = _sparse[handle.index];
+        return slot != NONE && _handles[slot] == handle ? slot : NONE;
+      }
+
+      std::vector<std::uint32_t> _sparse;
+      std::vector<Handle> _handles;
+      std::vector<T> _components;
+    };
+
+    /**
+     * @brief Hands out entity handles and owns one ComponentPool per component type.
+     *
+     * Systems walk the pools with Each, which visits the components in the order they are stored in. Destroying
+     * an entity while a system is running is deferred until the outermost Each is over, so systems never see a
+     * pool shrink underneath them. Main thread only.
+     */
+    class World {
+      public:
+      World();
+      World(const World&) = delete;
+      World& operator=(const World&) = delete;
+      ~World();
+
+      Handle Create();
+      void Destroy(Handle handle);
+      bool IsAlive(Handle handle) const;
+      size_t NumAlive() const;
+      /**
+       * @brief Destroys every entity and drops every component, handles created before are never alive again.
+       */
+      void Clear();
+
+      template <typename T, typename... Args>
+      T& Add(Handle handle, Args&&... args) {
+        return Pool<T>().Add(handle, std::forward<Args>(args)...);
+      }
+
+      template <typename T>
+      void Remove(Handle handle) {
+        Pool<T>().Remove(handle);
+      }
+
+      /**
+       * @return nullptr when the entity is dead or has no such component
+       */
+      template <typename T>
+      T* Get(Handle handle) {
+        return Pool<T>().Get(handle);
+      }
+
+      template <typename T>
+      bool Has(Handle handle) {
+        return Pool<T>().Has(handle);
+      }
+
+      template <typename T>
+      ComponentPool<T>& Pool() {
+        const size_t id = ComponentId<T>();
+        if (id >= _pools.size()) {
+          _pools.resize(id + 1);
+        }
+        if (_pools[id] == nullptr) {
+          _pools[id] = std::make_unique<ComponentPool<T>>();
+        }
+        return *static_cast<ComponentPool<T>*>(_pools[id].get());
+      }
+
+      /**
+       * @brief Calls fn(handle, component) for every component of type T. Components added by fn wait for the next
+       * Each, the reference fn is given is not good past one.
+       */
+      template <typename T, typename F>
+      void Each(F&& fn) {
+        ComponentPool<T>& pool = Pool<T>();
+        Iterating iterating(this);
+        const size_t count = pool.Size();
+        for (size_t i = 0; i < count && i < pool.Size(); i++) {
+          fn(pool.Handles()[i], pool.Components()[i]);
+        }
+      }
+
+      /**
+       * @brief Calls fn(handle, a, b) for every entity with both an A and a B, walking the A pool.
+       */
+      template <typename A, typename B, typename F>
+      void Each(F&& fn) {
+        ComponentPool<A>& first = Pool<A>();
+        ComponentPool<B>& second = Pool<B>();
+        Iterating iterating(this);
+        const size_t count = first.Size();
+        for (size_t i = 0; i < count && i < first.Size(); i++) {
+          const Handle handle = first.Handles()[i];
+          if (B* b = second.Get(handle)) {
+            fn(handle, first.Components()[i], *b);
+          }
+        }
+      }
+
+      /**
+       * @brief Makes this the world entities are created in by default, see CoroutineScheduler::MakeCurrent
+       */
+      void MakeCurrent();
+      /**
+       * @return the world made current last, or an engine owned one if no world was made current yet
+       */
+      static World* Current();
+
+      private:
+      class Iterating {
+        public:
+        explicit Iterating(World* world) : _world(world) { _world->_iterating++; }
+        ~Iterating() {
+          if (--_world->_iterating == 0) {
+            _world->DestroyPending();
+          }
+        }
+
+        private:
+        World* _world;
+      };
+
+      template <typename T>
+      static size_t ComponentId() {
+        static const size_t id = NextComponentId();
+        return id;
+      }
+      static size_t NextComponentId();
+
+      void DestroyPending();
+
+      std::vector<std::uint32_t> _generations;
+      std::vector<std::uint32_t> _free;
+      std::vector<std::unique_ptr<IComponentPool>> _pools;
+      std::vector<Handle> _pending;
+      size_t _alive;
+      unsigned int _iterating;
+
+      static World* _current;
+    };
+
+  }  // namespace ECS
+}  // namespace CoffeeMaker
+
+#endif
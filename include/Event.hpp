@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+#include "EventBus.hpp"
 #include "Events/MouseEvents.hpp"
 #include "Events/UserEvents.hpp"
 
@@ -51,7 +52,7 @@ namespace CoffeeMaker {
     ~UserEventEmitter() = default;
 
     /**
-     * @brief Alias for CoffeeMaker::PushUserEvent
+     * @brief Alias for CoffeeMaker::PublishEvent
      *
      * @param type
      * @param eventCode
@@ -59,7 +60,7 @@ namespace CoffeeMaker {
      * @param data2
      */
     void EmitUserEvent(Uint32 type, Sint32 eventCode = -1, void* data1 = nullptr, void* data2 = nullptr) {
-      CoffeeMaker::PushUserEvent(type, eventCode, data1, data2);
+      CoffeeMaker::PublishEvent(type, eventCode, data1, data2);
     }
   };
 
@@ -70,7 +71,7 @@ namespace CoffeeMaker {
     ~Delegate();
 
     inline void Invoke(const Event& event) { _function(event); }
-    inline std::function<void(const Event& event)> Get() { return _function; }
+    inline const std::function<void(const Event& event)>& Get() const { return _function; }
     inline bool operator==(const Delegate& rhs) const { return _id == rhs._id; }
 
     private:
@@ -0,0 +1,138 @@
+#ifndef _coffeemaker_eventbus_hpp
+#define _coffeemaker_eventbus_hpp
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "MPSCQueue.hpp"
+
+namespace CoffeeMaker {
+  class EventBus;
+
+  /**
+   * @brief Keeps a handler subscribed to an EventBus, the handler is unsubscribed when this is destroyed or reset.
+   */
+  class EventSubscription {
+    public:
+    EventSubscription();
+    EventSubscription(EventBus* bus, std::uint64_t id);
+    EventSubscription(EventSubscription&& other) noexcept;
+    EventSubscription& operator=(EventSubscription&& other) noexcept;
+    EventSubscription(const EventSubscription&) = delete;
+    EventSubscription& operator=(const EventSubscription&) = delete;
+    ~EventSubscription();
+
+    void Reset();
+    bool IsActive() const;
+
+    private:
+    EventBus* _bus;
+    std::uint64_t _id;
+  };
+
+  using EventSubscriptions = std::vector<EventSubscription>;
+
+  /**
+   * @brief In engine replacement for pushing gameplay events through the SDL event queue.
+   *
+   * Handlers subscribe to a single event type, either for every event of that type or only the ones sent to a
+   * target through data1, so an event only reaches the handlers that care about it. Published events are
+   * double buffered: everything published during a frame is delivered by the next Dispatch, and events published
+   * while dispatching wait for the one after. Publish may be called from any thread and never blocks on a lock
+   * while the queue has room, subscribing and dispatching happen on the main thread.
+   */
+  class EventBus {
+    public:
+    using Handler = std::function<void(const SDL_UserEvent& event)>;
+
+    EventBus();
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+    ~EventBus() = default;
+
+    /**
+     * @brief Subscribes to every event of the given type.
+     */
+    [[nodiscard]] EventSubscription Subscribe(Uint32 type, Handler handler);
+    /**
+     * @brief Subscribes to the events of the given type published with target as data1.
+     */
+    [[nodiscard]] EventSubscription Subscribe(Uint32 type, const void* target, Handler handler);
+    /**
+     * @brief Subscribes to every event of every type, after the type and target subscribers have seen it.
+     */
+    [[nodiscard]] EventSubscription SubscribeAll(Handler handler);
+
+    void Publish(Uint32 type, Sint32 code = -1, void* data1 = nullptr, void* data2 = nullptr);
+    void Publish(const SDL_UserEvent& event);
+
+    /**
+     * @brief Delivers every event published since the last Dispatch.
+     *
+     * @return number of events delivered
+     */
+    size_t Dispatch();
+
+    size_t NumQueued() const;
+    const Async::MPSCQueue<SDL_UserEvent>& Queue() const;
+    size_t NumSubscribers(Uint32 type) const;
+    size_t NumSubscribers(Uint32 type, const void* target) const;
+
+    static constexpr size_t QUEUE_CAPACITY = 1024;
+
+    static EventBus* Instance();
+    /**
+     * @brief Dispatches the engine owned bus, once a frame after the SDL events were polled.
+     */
+    static size_t ProcessEvents();
+
+    private:
+    friend class EventSubscription;
+
+    struct Subscriber {
+      std::uint64_t id;
+      Handler handler;
+      bool removed;
+    };
+    // NOTE: deques, a handler subscribing mid dispatch never moves the subscriber being invoked
+    using Subscribers = std::deque<Subscriber>;
+    struct Channel {
+      Subscribers any;
+      std::unordered_map<const void*, Subscribers> routed;
+    };
+    struct Location {
+      Uint32 type;
+      const void* target;
+      bool all;
+    };
+
+    EventSubscription Add(Subscribers& subscribers, Location location, Handler handler);
+    void Unsubscribe(std::uint64_t id);
+    void Compact();
+    static void Deliver(const Subscribers& subscribers, const SDL_UserEvent& event);
+    static size_t CountActive(const Subscribers& subscribers);
+
+    std::unordered_map<Uint32, Channel> _channels;
+    Subscribers _all;
+    std::unordered_map<std::uint64_t, Location> _locations;
+    Async::MPSCQueue<SDL_UserEvent> _queue;
+    std::vector<SDL_UserEvent> _front;
+    std::uint64_t _nextId;
+    bool _dispatching;
+    bool _stale;
+  };
+
+  /**
+   * @brief Publishes a gameplay event on the engine owned EventBus, see CoffeeMaker::PushUserEvent
+   */
+  void PublishEvent(Uint32 type, Sint32 eventCode = -1, void* data1 = nullptr, void* data2 = nullptr);
+
+}  // namespace CoffeeMaker
+
+#endif
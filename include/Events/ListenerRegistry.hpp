@@ -0,0 +1,88 @@
+#ifndef _coffeemaker_listener_registry_hpp
+#define _coffeemaker_listener_registry_hpp
+
+#include <cstddef>
+#include <vector>
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief Registry behind the IUserEventListener and IMouseListener interfaces.
+   *
+   * Every listener keeps the index of its slot, so removing one only clears that slot. Cleared slots are squeezed
+   * out by Compact, once per frame, instead of after every event. Listeners added while events are being
+   * dispatched go to the back and are not called until the next event.
+   */
+  template <typename Listener>
+  class ListenerRegistry {
+    public:
+    ListenerRegistry() = default;
+    // NOTE: the listeners keep their slot indices, a copy would hand out the same slots twice
+    ListenerRegistry(const ListenerRegistry&) = delete;
+    ListenerRegistry& operator=(const ListenerRegistry&) = delete;
+
+    /**
+     * @return index of the listener's slot, valid until the next Compact
+     */
+    size_t Add(Listener* listener) {
+      _slots.push_back(listener);
+      return _slots.size() - 1;
+    }
+
+    void Remove(size_t index) {
+      _slots[index] = nullptr;
+      _stale++;
+    }
+
+    template <typename F>
+    void ForEach(F&& fn) {
+      // NOTE: only the listeners registered before this event, slots never move while dispatching
+      const size_t count = _slots.size();
+      _dispatching++;
+      for (size_t i = 0; i < count; i++) {
+        if (_slots[i] != nullptr) {
+          fn(_slots[i]);
+        }
+      }
+      _dispatching--;
+    }
+
+    /**
+     * @brief Drops the cleared slots in a single pass, keeping the order listeners were added in.
+     *
+     * @param moved called with every listener whose slot changed, and its new index
+     */
+    template <typename F>
+    void Compact(F&& moved) {
+      if (_stale == 0 || _dispatching > 0) {
+        return;
+      }
+      size_t next = 0;
+      for (size_t i = 0; i < _slots.size(); i++) {
+        if (_slots[i] != nullptr) {
+          if (i != next) {
+            _slots[next] = _slots[i];
+            moved(_slots[next], next);
+          }
+          next++;
+        }
+      }
+      _slots.resize(next);
+      _stale = 0;
+    }
+
+    /**
+     * @brief Slots in use, including the ones cleared since the last Compact.
+     */
+    size_t Size() const { return _slots.size(); }
+    size_t NumStale() const { return _stale; }
+
+    private:
+    std::vector<Listener*> _slots;
+    size_t _stale = 0;
+    unsigned int _dispatching = 0;
+  };
+
+}  // namespace CoffeeMaker
+
+#endif
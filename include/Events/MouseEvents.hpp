@@ -3,7 +3,7 @@
 
 #include <SDL2/SDL.h>
 
-#include <vector>
+#include "Events/ListenerRegistry.hpp"
 
 namespace CoffeeMaker {
   class MouseEventHandler;
@@ -24,6 +24,9 @@ namespace CoffeeMaker {
     IMouseListener();
 
     public:
+    // NOTE: a copy would share the registry slot of the original and clear it when destroyed
+    IMouseListener(const IMouseListener&) = delete;
+    IMouseListener& operator=(const IMouseListener&) = delete;
     virtual ~IMouseListener();
     virtual void OnMouseDown(const SDL_MouseButtonEvent& event) = 0;
     virtual void OnMouseUp(const SDL_MouseButtonEvent& event) = 0;
@@ -37,10 +40,10 @@ namespace CoffeeMaker {
     private:
     bool _active;
     unsigned int _id;
-    // size_t _index;
+    size_t _index;
     static unsigned int _uid;
 
-    static std::vector<IMouseListener*> _listeners;
+    static ListenerRegistry<IMouseListener> _listeners;
     static void ProcessMouseMotionEvent(const SDL_MouseMotionEvent& event);
     static void ProcessMouseButtonEvent(const SDL_MouseButtonEvent& event);
     static void ProcessMouseWheelEvent(const SDL_MouseWheelEvent& event);
@@ -50,6 +53,9 @@ namespace CoffeeMaker {
   class MouseEventHandler {
     public:
     static void HandleMouseEvents(const SDL_Event& event);
+    /**
+     * @brief Forgets the listeners destroyed since the last call, once per frame after the events were handled.
+     */
     static void ClearMouseEvents();
   };
 }  // namespace CoffeeMaker
@@ -3,8 +3,7 @@
 
 #include <SDL2/SDL.h>
 
-#include <vector>
-
+#include "Events/ListenerRegistry.hpp"
 #include "Logger.hpp"
 
 namespace CoffeeMaker {
@@ -21,17 +20,20 @@ namespace CoffeeMaker {
     virtual ~IUserEventListener();
 
     public:
+    // NOTE: a copy would share the registry slot of the original and clear it when destroyed
+    IUserEventListener(const IUserEventListener&) = delete;
+    IUserEventListener& operator=(const IUserEventListener&) = delete;
     virtual void OnSDLUserEvent(const SDL_UserEvent& event) = 0;
 
-    static size_t NumListeners() { return _listeners.size(); }
+    static size_t NumListeners() { return _listeners.Size(); }
 
     friend class UserEventHandler;
 
     private:
     unsigned int _id;
-    // size_t _index;
+    size_t _index;
     static unsigned int _uid;
-    static std::vector<IUserEventListener*> _listeners;
+    static ListenerRegistry<IUserEventListener> _listeners;
     static void ProcessUserEvent(const SDL_UserEvent& event);
     static void RemoveStaleListeners();
   };
@@ -53,8 +55,10 @@ namespace CoffeeMaker {
 
     static void HandleUserEvent(const SDL_UserEvent& event) {
       CoffeeMaker::IUserEventListener::ProcessUserEvent(event);
-      ClearUserEvents();
     }
+    /**
+     * @brief Forgets the listeners destroyed since the last call, once per frame after the events were handled.
+     */
     static void ClearUserEvents() { CoffeeMaker::IUserEventListener::RemoveStaleListeners(); }
   };
 
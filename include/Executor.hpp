@@ -0,0 +1,54 @@
+#ifndef _coffeemaker_executor_hpp
+#define _coffeemaker_executor_hpp
+
+#include <cstddef>
+#include <functional>
+
+#include "MPSCQueue.hpp"
+
+namespace CoffeeMaker {
+  namespace Async {
+
+    /**
+     * @brief Ready queue of work that must run on the main thread, ie: coroutines whose awaiter finished.
+     *
+     * Any thread can post without taking a lock, the main loop drains the queue once per frame. Work posted while the
+     * queue is being drained waits for the next drain, so a coroutine that keeps yielding can never stall the frame.
+     */
+    class Executor {
+      public:
+      using Job = std::function<void(void)>;
+
+      Executor();
+      Executor(const Executor&) = delete;
+      Executor& operator=(const Executor&) = delete;
+
+      /**
+       * @brief Queues the job to run on the next drain. Safe to call from any thread.
+       */
+      void Post(Job job);
+      /**
+       * @brief Runs every job posted before the call, in the order they were posted.
+       *
+       * @return number of jobs that ran
+       */
+      size_t Drain();
+      size_t NumReady() const;
+      const MPSCQueue<Job>& Queue() const;
+
+      static constexpr size_t QUEUE_CAPACITY = 1024;
+
+      /**
+       * @brief The engine owned executor, drained by the main loop.
+       */
+      static Executor* Instance();
+      static size_t ProcessReady();
+
+      private:
+      MPSCQueue<Job> _ready;
+    };
+
+  }  // namespace Async
+}  // namespace CoffeeMaker
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef _coffeemaker_file_hpp
 #define _coffeemaker_file_hpp
 
+#include <cstddef>
 #include <string>
 
 namespace CoffeeMaker {
@@ -11,6 +12,50 @@ namespace CoffeeMaker {
     char* data;
   };
 
+  /**
+   * @brief Reads a whole file into a null terminated, malloc'd buffer. Blocks, run it on the ThreadPool.
+   *
+   * @param fileName
+   * @return File with loaded set to false if the file could not be read
+   */
+  File ReadFile(const std::string& fileName);
+  /**
+   * @brief Replaces the contents of a file. Blocks, run it on the ThreadPool.
+   *
+   * @return true if every byte was written
+   */
+  bool WriteFile(const std::string& fileName, const std::string& data);
+
+  /**
+   * @brief Read only view of a whole file mapped into memory, unmapped when destroyed. Opening it reads nothing,
+   * pages are read in by the OS as they are touched. Blocks on the disk, run it on the ThreadPool.
+   */
+  class MappedFile {
+    public:
+    MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    /**
+     * @return false if the file could not be mapped or is empty
+     */
+    bool Open(const std::string& fileName);
+    void Close();
+
+    bool IsOpen() const;
+    const char* Data() const;
+    size_t Size() const;
+
+    private:
+    const char* _data;
+    size_t _size;
+#ifdef _WIN32
+    void* _file;
+    void* _mapping;
+#endif
+  };
+
 }  // namespace CoffeeMaker
 
 #endif
@@ -0,0 +1,109 @@
+#ifndef _coffeemaker_fixedtimestep_hpp
+#define _coffeemaker_fixedtimestep_hpp
+
+#include <SDL2/SDL.h>
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief Accumulates real frame time and hands it out as a whole number of fixed simulation steps.
+   * Whatever is left over is exposed as Alpha, how far rendering is between the last two steps.
+   *
+   * Under a frame spike several steps are run instead of one long one. The number of steps per frame is capped
+   * so a slow simulation cannot fall further and further behind, time beyond the cap is dropped.
+   */
+  class FixedTimestep {
+    public:
+    static constexpr double DEFAULT_TICK_RATE = 120.0;
+    static constexpr int DEFAULT_MAX_STEPS_PER_FRAME = 8;
+
+    explicit FixedTimestep(double tickRate = DEFAULT_TICK_RATE,
+                           int maxStepsPerFrame = DEFAULT_MAX_STEPS_PER_FRAME);
+    ~FixedTimestep();
+
+    /**
+     * @brief Adds the real time that passed since the last frame.
+     *
+     * @param elapsedSeconds
+     * @return int the number of steps to simulate this frame
+     */
+    int Accumulate(double elapsedSeconds);
+    /**
+     * @brief Marks the start of a simulation step.
+     */
+    void Step();
+    /**
+     * @brief Seconds simulated by one step.
+     */
+    float DeltaTime() const;
+    double TickRate() const;
+    void SetTickRate(double tickRate);
+    /**
+     * @brief Fraction of a step left in the accumulator, in [0, 1).
+     */
+    float Alpha() const;
+    /**
+     * @brief Number of steps run so far.
+     */
+    Uint64 Tick() const;
+    /**
+     * @brief Number of steps skipped because a frame needed more than the cap.
+     */
+    Uint64 DroppedSteps() const;
+
+    /**
+     * @brief Makes this the loop that CurrentTick and InterpolationAlpha report on.
+     */
+    void MakeCurrent();
+    /**
+     * @brief Tick of the current loop, 0 if there is none.
+     */
+    static Uint64 CurrentTick();
+    /**
+     * @brief Alpha of the current loop, 1 if there is none so positions render as they are.
+     */
+    static float InterpolationAlpha();
+
+    private:
+    static FixedTimestep* _current;
+
+    double _stepSeconds;
+    double _accumulator;
+    int _maxStepsPerFrame;
+    Uint64 _tick;
+    Uint64 _droppedSteps;
+  };
+
+  /**
+   * @brief A position written once per simulation step and read back blended between the last two steps.
+   */
+  class InterpolatedPoint {
+    public:
+    InterpolatedPoint();
+
+    /**
+     * @brief Records the position reached in the current step.
+     */
+    void Update(float x, float y);
+    /**
+     * @brief Moves to the position without blending from the old one, ie: when spawning.
+     */
+    void Reset(float x, float y);
+    /**
+     * @brief The position to render at. Positions not updated in the latest step are returned as is.
+     */
+    SDL_FPoint Get() const;
+    /**
+     * @brief The position last recorded, without blending.
+     */
+    SDL_FPoint Current() const;
+
+    private:
+    SDL_FPoint _previous;
+    SDL_FPoint _current;
+    Uint64 _tick;
+  };
+
+}  // namespace CoffeeMaker
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef _coffeemaker_framearena_hpp
+#define _coffeemaker_framearena_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief Bump allocator for data that only lives until the end of the frame.
+   *
+   * Allocating moves a pointer forward, Reset moves it back to the start, nothing is freed one by one and no
+   * destructors are run. A frame that needs more than the capacity is served from extra heap blocks, the next Reset
+   * grows the arena to fit so the following frames no longer touch the heap.
+   */
+  class FrameArena {
+    public:
+    static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY);
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Returns size bytes aligned to alignment, valid until the next Reset.
+     *
+     * @param size
+     * @param alignment a power of two
+     * @return void*
+     */
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T, typename... Args>
+    T* New(Args&&... args) {
+      static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+      return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns count default initialized Ts.
+     */
+    template <typename T>
+    T* NewArray(size_t count) {
+      static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+      return new (Allocate(sizeof(T) * count, alignof(T))) T[count];
+    }
+
+    /**
+     * @brief Releases everything allocated since the last Reset.
+     */
+    void Reset();
+
+    /**
+     * @brief Bytes allocated since the last Reset, including padding.
+     */
+    size_t Used() const;
+    size_t Capacity() const;
+    /**
+     * @brief Most bytes ever used between two Resets.
+     */
+    size_t HighWater() const;
+    /**
+     * @brief Number of extra heap blocks taken because the arena was full.
+     */
+    size_t Overflows() const;
+
+    /**
+     * @brief The engine owned arena, reset by the main loop at the start of every frame.
+     */
+    static FrameArena* Frame();
+
+    private:
+    static std::uintptr_t Align(std::uintptr_t address, size_t alignment);
+
+    std::unique_ptr<std::byte[]> _memory;
+    size_t _capacity;
+    size_t _offset;
+    std::vector<std::unique_ptr<std::byte[]>> _overflow;
+    size_t _overflowUsed;
+    size_t _highWater;
+    size_t _overflows;
+  };
+
+  /**
+   * @brief Lets standard containers use a FrameArena, ie: std::vector<int, ArenaAllocator<int>>. Deallocating is a
+   * no-op, the memory comes back when the arena is reset, so the container must not outlive the frame.
+   */
+  template <typename T>
+  class ArenaAllocator {
+    public:
+    using value_type = T;
+
+    explicit ArenaAllocator(FrameArena* arena) : _arena(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other.Arena()) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(_arena->Allocate(sizeof(T) * count, alignof(T))); }
+    void deallocate(T*, size_t) {}
+
+    FrameArena* Arena() const { return _arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& rhs) const {
+      return _arena == rhs.Arena();
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& rhs) const {
+      return _arena != rhs.Arena();
+    }
+
+    private:
+    FrameArena* _arena;
+  };
+
+  /**
+   * @brief A vector that lives until the end of the frame, see ArenaAllocator.
+   */
+  template <typename T>
+  using FrameVector = std::vector<T, ArenaAllocator<T>>;
+
+}  // namespace CoffeeMaker
+
+#endif
@@ -3,7 +3,9 @@
 
 #include <functional>
 
+#include "CoroutineScheduler.hpp"
 #include "Event.hpp"
+#include "Game/PathFollowerSystem.hpp"
 #include "Math.hpp"
 #include "Spline.hpp"
 #include "Utilities.hpp"
@@ -42,6 +44,8 @@ namespace Animations {
     void OnComplete(std::function<void(void *)>);
 
     protected:
+    void ProcessComplete();
+
     std::vector<std::function<void(void *)>> _startListeners;
     std::vector<std::function<void(void *)>> _completeListeners;
   };
@@ -52,51 +56,75 @@ namespace Animations {
     ~EnemyEntrance() = default;
   };
 
+  /**
+   * @brief Follows the entrance001 path, moved along by PathFollowerSystem::Update while it is running.
+   */
   class EnemyEntrance001 : public SplineAnimation {
     public:
     explicit EnemyEntrance001(float duration = 1.75f);
     explicit EnemyEntrance001(bool inverted, float duration = 1.75f);
-    ~EnemyEntrance001() = default;
+    EnemyEntrance001(const EnemyEntrance001 &) = delete;
+    EnemyEntrance001 &operator=(const EnemyEntrance001 &) = delete;
+    ~EnemyEntrance001();
 
+    /**
+     * @brief Stops the animation at the start of the path.
+     */
     void Reset();
-    void Update(float deltaTime);
+    void Start();
+    void Stop();
     CoffeeMaker::Math::Point2D CurrentPosition();
+    bool Complete() const;
+    /**
+     * @brief Ends this animation's path at pos, the shared spline itself is never changed.
+     */
     void SetFinalPosition(const CoffeeMaker::Math::Point2D &pos);
+    /**
+     * @brief Starts loading the spline on the ThreadPool, unless it was already. Called during scene init so the
+     * load is over by the time the first enemy spawns, every constructor calls it as well.
+     *
+     * @return PathId, not cached so a path dropped by PathFollowerSystem::Destroy is loaded again
+     */
+    static PathFollowerSystem::PathId Preload();
 
     private:
-    float _inverted;
-    float _knot;
-    float _currentTime;
-    float _duration;
-    CoffeeMaker::Math::Point2D _currentPoint;
-
-    static Scope<CoffeeMaker::BSpline> _bSpline;
-    static Scope<CoffeeMaker::BSpline> _bSplineInverted;
-    static void LoadBSpline();
+    PathFollowerSystem::FollowerId _follower;
   };
 
+  /**
+   * @brief Follows the exit001 path, moved along by PathFollowerSystem::Update while it is running.
+   */
   class EnemyExit001 : public SplineAnimation {
     public:
     explicit EnemyExit001(float duration = 1.75f);
     explicit EnemyExit001(bool inverted, float duration = 1.75f);
-    ~EnemyExit001() = default;
+    EnemyExit001(const EnemyExit001 &) = delete;
+    EnemyExit001 &operator=(const EnemyExit001 &) = delete;
+    ~EnemyExit001();
 
+    /**
+     * @brief Stops the animation at the start of the path.
+     */
     void Reset();
-    void Update(float deltaTime);
+    void Start();
+    void Stop();
     CoffeeMaker::Math::Point2D CurrentPosition();
+    bool Complete() const;
+    /**
+     * @brief Starts this animation's path at pos, the shared spline itself is never changed.
+     */
     void SetFirstPosition(const CoffeeMaker::Math::Point2D &pos);
     void Invert(bool invert);
+    /**
+     * @brief Starts loading the spline on the ThreadPool, unless it was already. Called during scene init so the
+     * load is over by the time the first enemy spawns, every constructor calls it as well.
+     *
+     * @return PathId, not cached so a path dropped by PathFollowerSystem::Destroy is loaded again
+     */
+    static PathFollowerSystem::PathId Preload();
 
     private:
-    float _inverted;
-    float _knot;
-    float _currentTime;
-    float _duration;
-    CoffeeMaker::Math::Point2D _currentPoint;
-
-    static Scope<CoffeeMaker::BSpline> _bSpline;
-    static Scope<CoffeeMaker::BSpline> _bSplineInverted;
-    static void LoadBSpline();
+    PathFollowerSystem::FollowerId _follower;
   };
 
   /**
@@ -119,6 +147,17 @@ namespace Animations {
     ~EnemyExit() = default;
   };
 
+  /**
+   * @brief Waits for a spline animation to reach its end, ie: co_await Animations::SplineComplete(*_exitSpline)
+   * The animation must outlive the wait.
+   */
+  template <typename Animation>
+  CoffeeMaker::Await::Until SplineComplete(const Animation &animation,
+                                           CoffeeMaker::CoroutineScheduler *scheduler =
+                                               CoffeeMaker::CoroutineScheduler::Current()) {
+    return CoffeeMaker::Await::Until([&animation]() { return animation.Complete(); }, scheduler);
+  }
+
 }  // namespace Animations
 
 #endif
@@ -40,6 +40,8 @@ namespace Animations {
     Scope<CoffeeMaker::StopWatch> _stopwatch;
     unsigned int _currentFrame;
     int _id;
+    // NOTE: slot in _animations, so an animation leaves it without searching for itself
+    size_t _index;
     std::function<void(void)> _onCompleteCallback;
 
     static std::vector<SpriteAnimation*> _animations;
@@ -3,15 +3,19 @@
 
 #include <SDL2/SDL.h>
 
+#include <array>
+#include <cstdint>
 #include <functional>
-#include <queue>
 #include <vector>
 
+#include "FrameArena.hpp"
+#include "Game/SpatialGrid.hpp"
 #include "Texture.hpp"
 
 class Collider {
   public:
   enum class Type { Default, Projectile, Enemy, Player, EnemyProjectile };
+  static constexpr size_t NUM_TYPES = 5;
   std::string ColliderTypeString(Collider::Type type) {
     switch (type) {
       case Collider::Type::Projectile:
@@ -26,7 +30,17 @@ class Collider {
         return "Default";
     }
   }
+  /**
+   * Runs the broadphase over every active collider and queues an OnCollision for
+   * both sides of each overlapping pair.
+   */
   static void PhysicsUpdate();
+  /**
+   * Dispatches OnCollision to both sides of every contact found since the last call.
+   * A pair is dispatched at most once per call, no matter how many physics updates
+   * reported it. Contacts are dispatched in the order of the ids of their colliders,
+   * the same on every run.
+   */
   static void ProcessCollisions();
   /**
    * Pops all unprocessed collisions within the collision queue without processing
@@ -34,13 +48,45 @@ class Collider {
    * no longer matter.
    */
   static void ClearAllUnprocessedCollisions();
-  static std::queue<std::function<void()>> collisionQueue;
+  /**
+   * @brief The number of contacts dispatched by the last ProcessCollisions.
+   *
+   * @return Uint32
+   */
+  static Uint32 Contacts();
+  /**
+   * @brief The most contacts dispatched by a single ProcessCollisions so far.
+   *
+   * @return Uint32
+   */
+  static Uint32 PeakContacts();
+  /**
+   * Enables or disables collisions between two collider types, both directions
+   * are updated. Pairs that can never collide are dropped by the broadphase before
+   * any overlap test is run.
+   */
+  static void SetLayerCollision(Type a, Type b, bool collides);
+  static bool CanCollide(Type a, Type b);
+  /**
+   * Queues a contact between two colliders found outside of the broadphase, it is
+   * dispatched with the rest of the frame's contacts in ProcessCollisions.
+   */
+  static void QueueContact(Collider* a, Collider* b);
+  /**
+   * Fills the given vector with every active collider, it is grown once at most so
+   * the arena is not left with outgrown copies.
+   */
+  static void CollectActive(CoffeeMaker::FrameVector<Collider*>& colliders);
 
   Collider(Type type = Type::Default, bool active = false);
   ~Collider();
 
   void Update(const SDL_FRect& position);
   void OnCollision(Collider* collider);
+  /**
+   * Adds a listener for OnCollision. A listener added by another one while it is being
+   * called is first called on the next collision.
+   */
   void OnCollide(std::function<void(Collider*)> callback);
 
   // Render the collider for debugging purposes
@@ -57,13 +103,31 @@ class Collider {
   bool active;
 
   private:
+  struct Contact {
+    Collider* first;
+    Collider* second;
+  };
+
   Type _type;
   int _id;
+  // NOTE: slot in _colliders, so a collider leaves it without searching for itself
+  size_t _index;
   static int _colliderId;
   static std::vector<Collider*> _colliders;
+  static std::vector<Collider*> _activeColliders;
+  static std::vector<SDL_FRect> _activeRects;
+  static std::vector<std::uint32_t> _activeLayers;
+  static std::vector<std::uint32_t> _activeMasks;
+  static std::array<std::uint32_t, NUM_TYPES> _layerMatrix;
+  static SpatialGrid _grid;
+  static std::vector<Contact> _contacts;
+  static Uint32 _numContacts;
+  static Uint32 _peakContacts;
   CoffeeMaker::Texture _texture;
-  void CheckForCollision();
   std::vector<std::function<void(Collider*)>> _listeners;
+  // NOTE: added while the listeners are being called, they join them once the dispatch is over
+  std::vector<std::function<void(Collider*)>> _pendingListeners;
+  unsigned int _dispatching;
   bool _AxisAlignedBoundingBoxHit(Collider* collider) const;
 };
 
@@ -0,0 +1,36 @@
+#ifndef _game_components_hpp
+#define _game_components_hpp
+
+#include "Game/Collider.hpp"
+#include "Math.hpp"
+#include "Sprite.hpp"
+
+namespace UCI {
+  namespace Components {
+
+    /**
+     * @brief Where an entity is, the sprite and collider of the entity follow it.
+     */
+    struct Transform {
+      CoffeeMaker::Math::Vector2D position;
+      double rotation;
+    };
+
+    /**
+     * @brief Sprite drawn at the entity's transform, owned by the entity.
+     */
+    struct Sprite {
+      CoffeeMaker::Sprite* sprite;
+    };
+
+    /**
+     * @brief Collider moved along with the entity's transform, owned by the entity.
+     */
+    struct Body {
+      Collider* collider;
+    };
+
+  }  // namespace Components
+}  // namespace UCI
+
+#endif
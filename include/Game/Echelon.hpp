@@ -77,6 +77,7 @@ class Echelon : public CoffeeMaker::IUserEventListener {
 
   void Render() {
     SDL_Color yellow = CoffeeMaker::Colors::Yellow;
+    CoffeeMaker::Renderer::Flush();
     SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), yellow.r, yellow.g, yellow.b, yellow.a);
     SDL_RenderDrawRectF(CoffeeMaker::Renderer::Instance(), &_debugRect);
   }
@@ -10,20 +10,23 @@
 
 #include "Async.hpp"
 #include "Audio.hpp"
+#include "ECS/World.hpp"
 #include "Event.hpp"
+#include "EventBus.hpp"
 #include "Game/Animations/EnemyAnimations.hpp"
 #include "Game/Animations/Explode.hpp"
 #include "Game/Collider.hpp"
+#include "Game/Components.hpp"
 #include "Game/Echelon.hpp"
 #include "Game/Entity.hpp"
 #include "Game/Events.hpp"
-#include "Game/Projectile.hpp"
+#include "Game/ProjectileSystem.hpp"
 #include "Math.hpp"
 #include "Texture.hpp"
 #include "Timer.hpp"
 #include "Utilities.hpp"
 
-class Enemy : public Entity, public CoffeeMaker::IUserEventListener {
+class Enemy : public Entity {
   public:
   enum State { Idle, Entering, Exiting, Destroyed, StrafingRight, StrafingLeft, WillExit };
   enum AggressionState { Active, Passive };
@@ -48,17 +51,20 @@ class Enemy : public Entity, public CoffeeMaker::IUserEventListener {
   virtual void OnSDLUserEvent(const SDL_UserEvent& event);
 
   protected:
+  /**
+   * @brief Position and rotation of the enemy, its sprite and collider are moved there after the scene updated.
+   */
+  UCI::Components::Transform& Transform();
+
   static unsigned int _uid;
 
   std::string _id;
   bool _active;
-  double _rotation;
   float _speed;
-  int _currentProjectile;
   Ref<Collider> _collider;
-  std::vector<Projectile*> _projectiles;
   Scope<CoffeeMaker::Sprite> _sprite;
-  CoffeeMaker::Math::Vector2D _position;
+  CoffeeMaker::ECS::World* _world;
+  CoffeeMaker::ECS::Handle _entity;
   Scope<Animations::EnemyEntrance001> _entranceSpline2;
   Scope<Animations::EnemyExit001> _exitSpline;
   Scope<CoffeeMaker::Async::IntervalTask> _fireMissileTask;
@@ -68,6 +74,7 @@ class Enemy : public Entity, public CoffeeMaker::IUserEventListener {
   Scope<CoffeeMaker::AudioElement> _impactSound;
   State _state;
   AggressionState _aggression;
+  CoffeeMaker::EventSubscriptions _subscriptions;
 };
 
 class EchelonEnemy : public Enemy, public EchelonItem {
@@ -6,6 +6,7 @@
 #include <string>
 
 #include "Event.hpp"
+#include "EventBus.hpp"
 #include "Timer.hpp"
 #include "Utilities.hpp"
 #include "Widgets/ScalableUISprite.hpp"
@@ -19,7 +20,7 @@ class HeadsUpDisplayEvent {
   static void RemoveListener();
 };
 
-class HeadsUpDisplay : public CoffeeMaker::IUserEventListener {
+class HeadsUpDisplay {
   public:
   HeadsUpDisplay();
   ~HeadsUpDisplay();
@@ -47,6 +48,7 @@ class HeadsUpDisplay : public CoffeeMaker::IUserEventListener {
   Ref<CoffeeMaker::Widgets::ScalableUISprite> panel;
   CoffeeMaker::Timer _timer;
   SDL_TimerID _timerId;
+  CoffeeMaker::EventSubscriptions _subscriptions;
 };
 
 #endif
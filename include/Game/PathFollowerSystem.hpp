@@ -0,0 +1,167 @@
+#ifndef _game_pathfollowersystem_hpp
+#define _game_pathfollowersystem_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "BakedSpline.hpp"
+#include "Math.hpp"
+#include "Utilities.hpp"
+
+/**
+ * @brief Moves everything that follows a baked spline path, ie: the enemy entrance and exit animations. Follower
+ * state is kept in parallel arrays so the clocks of every follower are advanced in one loop and their positions
+ * sampled in another, once a frame. The completion callbacks of the followers that reached the end of their path
+ * are called after both loops, together.
+ */
+class PathFollowerSystem {
+  public:
+  using PathId = std::uint16_t;
+  using Callback = std::function<void(void)>;
+
+  /**
+   * @brief Generational handle to a follower. The index of a removed follower is reused by the next one added, its
+   * generation is bumped so ids of the removed follower stop resolving instead of driving whatever took its place.
+   */
+  struct FollowerId {
+    std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t generation = 0;
+
+    bool operator==(const FollowerId& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const FollowerId& other) const { return !(*this == other); }
+  };
+
+  /**
+   * @brief A spline asset and its horizontally inverted twin. Neither changes once loaded, every follower anchors
+   * its own ends.
+   */
+  struct Paths {
+    CoffeeMaker::BakedSpline path;
+    CoffeeMaker::BakedSpline inverted;
+  };
+  using SharedPaths = std::shared_future<Ref<const Paths>>;
+
+  /**
+   * @brief Starts loading a .spline asset on the ThreadPool, see BSpline::LoadBaked, remapped to the current output
+   * size. Loading the same file again returns the path loaded the first time.
+   *
+   * @param filePath of the .spline asset, relative to the assets directory
+   * @return PathId
+   */
+  static PathId LoadPath(const std::string& filePath);
+  /**
+   * @brief Adds a path that is already baked.
+   */
+  static PathId AddPath(Paths paths);
+  /**
+   * @brief Waits for the path to be loaded, only blocks if it is sampled before the load is done. A path that could
+   * not be loaded is reported here, on the main thread.
+   */
+  static const Paths& GetPaths(PathId path);
+
+  /**
+   * @brief Adds a follower at the start of the path, it does not move until it is started.
+   *
+   * @param path
+   * @param duration seconds it takes to reach the end of the path
+   * @param inverted if true the follower takes the inverted twin of the path
+   * @param onComplete called once the follower reaches the end of the path
+   * @return FollowerId, good until the follower is removed. Every other call ignores ids of removed followers.
+   */
+  static FollowerId Add(PathId path, float duration, bool inverted, Callback onComplete);
+  static void Remove(FollowerId follower);
+
+  static void Start(FollowerId follower);
+  static void Stop(FollowerId follower);
+  /**
+   * @brief Stops the follower and moves it back to the start of its path.
+   */
+  static void Reset(FollowerId follower);
+  static void SetInverted(FollowerId follower, bool inverted);
+  /**
+   * @brief Moves the start of the path to position for this follower alone. The follower is sampled again right
+   * away if its path is loaded, so its Position moves with the anchor between two updates.
+   */
+  static void AnchorStart(FollowerId follower, const CoffeeMaker::Math::Point2D& position);
+  /**
+   * @brief Moves the end of the path to position for this follower alone, sampled again as AnchorStart does.
+   */
+  static void AnchorEnd(FollowerId follower, const CoffeeMaker::Math::Point2D& position);
+
+  /**
+   * @brief Where the follower was on its path when it was last sampled, (0, 0) for removed followers.
+   */
+  static CoffeeMaker::Math::Point2D Position(FollowerId follower);
+  static bool IsRunning(FollowerId follower);
+  static bool IsComplete(FollowerId follower);
+  static size_t Count();
+
+  /**
+   * @brief Advances every running follower by deltaTime, samples where they are, then calls the completion callbacks
+   * of the ones that reached the end of their path. Callbacks may start, stop, add and remove followers. Only the
+   * paths of running followers are waited for.
+   */
+  static void Update(float deltaTime);
+
+  /**
+   * @brief Advances count follower clocks by deltaTime and works out how far along their path they are. Stopped
+   * followers keep their clock, fractions are clamped to 1.0.
+   *
+   * @param elapsed seconds every follower has been running for
+   * @param fraction of the path every follower has covered
+   * @param duration seconds every follower takes to reach the end of its path
+   * @param running 1.0 for running followers, 0.0 for stopped ones
+   * @param count
+   * @param deltaTime
+   */
+  static void Advance(float* elapsed, float* fraction, const float* duration, const float* running, size_t count,
+                      float deltaTime);
+
+  /**
+   * @brief Removes every follower and path. PathIds handed out before are stale, load the paths again.
+   */
+  static void Destroy();
+
+  private:
+  static constexpr std::uint8_t ANCHOR_START = 1 << 0;
+  static constexpr std::uint8_t ANCHOR_END = 1 << 1;
+  static constexpr std::uint32_t NO_SLOT = std::numeric_limits<std::uint32_t>::max();
+  static constexpr float MIN_DURATION = 0.001f;
+
+  static SharedPaths Ready(Paths paths);
+  static std::uint32_t Slot(FollowerId follower);
+  static void Sample(size_t slot, const Paths& paths);
+  static void SampleIfLoaded(size_t slot);
+
+  static std::vector<SharedPaths> _paths;
+  static std::vector<std::string> _pathFiles;
+  static std::vector<const Paths*> _resolved;
+
+  // NOTE: indexed by slot, a removed follower's slot is taken over by the last one
+  static std::vector<PathId> _path;
+  static std::vector<float> _elapsed;
+  static std::vector<float> _duration;
+  static std::vector<float> _fraction;
+  static std::vector<float> _running;
+  static std::vector<std::uint8_t> _inverted;
+  static std::vector<std::uint8_t> _anchors;
+  static std::vector<CoffeeMaker::Math::Point2D> _startAnchor;
+  static std::vector<CoffeeMaker::Math::Point2D> _endAnchor;
+  static std::vector<CoffeeMaker::Math::Point2D> _position;
+  static std::vector<Callback> _onComplete;
+  static std::vector<FollowerId> _followers;
+
+  // NOTE: indexed by FollowerId::index
+  static std::vector<std::uint32_t> _slots;
+  static std::vector<std::uint32_t> _generations;
+  static std::vector<std::uint32_t> _free;
+
+  static std::vector<FollowerId> _completed;
+};
+
+#endif
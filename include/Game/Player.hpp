@@ -9,12 +9,16 @@
 
 #include "Async.hpp"
 #include "Audio.hpp"
+#include "ECS/World.hpp"
+#include "EventBus.hpp"
+#include "FixedTimestep.hpp"
 #include "Game/Animations/Explode.hpp"
 #include "Game/Collider.hpp"
+#include "Game/Components.hpp"
 #include "Game/Entity.hpp"
 #include "Math.hpp"
 #include "PowerUps/BasePowerUp.hpp"
-#include "Projectile.hpp"
+#include "ProjectileSystem.hpp"
 #include "Renderer.hpp"
 #include "Texture.hpp"
 #include "Timer.hpp"
@@ -45,6 +49,10 @@ class Player : public Entity, public CoffeeMaker::IUserEventListener {
   void OnSDLUserEvent(const SDL_UserEvent& event);
 
   private:
+  /**
+   * @brief Position and rotation of the player, its collider is moved there after the scene updated.
+   */
+  UCI::Components::Transform& Transform();
   void UpdateRespawnImmunity();
   bool IsOffScreenLeft();
   bool IsOffScreenRight();
@@ -54,17 +62,18 @@ class Player : public Entity, public CoffeeMaker::IUserEventListener {
 
   CoffeeMaker::Texture _texture{"PlayerV1.png", true};
   SDL_Rect _clipRect{.x = 0, .y = 0, .w = 32, .h = 32};
+  // NOTE: only the size, the position is kept in the transform
   SDL_FRect _clientRect{.x = 0,
                         .y = 0,
                         .w = 48 * CoffeeMaker::Renderer::DynamicResolutionDownScale(),
                         .h = 48 * CoffeeMaker::Renderer::DynamicResolutionDownScale()};
+  CoffeeMaker::InterpolatedPoint _renderPosition;
 
   bool _isImmune;
-  double _rotation;
-  std::vector<Projectile*> _projectiles;
-  int _currentProjectile;
   bool _firing;
   Collider* _collider;
+  CoffeeMaker::ECS::World* _world;
+  CoffeeMaker::ECS::Handle _entity;
   bool _active;
   bool _destroyed;
   unsigned int _lives;
@@ -78,6 +87,7 @@ class Player : public Entity, public CoffeeMaker::IUserEventListener {
   Scope<CoffeeMaker::Async::TimeoutTask> _fireDelay;
   Player::FireMissileState _fireMissileState;
   Scope<UCI::Warp> _warpPowerup;
+  CoffeeMaker::EventSubscriptions _subscriptions;
 };
 
 #endif
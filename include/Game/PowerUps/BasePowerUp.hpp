@@ -7,6 +7,7 @@
 #include "Async.hpp"
 #include "Audio.hpp"
 #include "Event.hpp"
+#include "EventBus.hpp"
 #include "Game/Entity.hpp"
 #include "Game/Events.hpp"
 #include "Logger.hpp"
@@ -83,6 +84,8 @@ namespace UCI {
       _charges.push_back(new PowerUpCharge(PowerUp::PowerUpType::Warp, enabledDuration, cooldownDuration));
       _charges.push_back(new PowerUpCharge(PowerUp::PowerUpType::Warp, enabledDuration, cooldownDuration));
       _charges.push_back(new PowerUpCharge(PowerUp::PowerUpType::Warp, enabledDuration, cooldownDuration));
+      _recharged = CoffeeMaker::EventBus::Instance()->Subscribe(
+          UCI::Events::PLAYER_POWER_UP_RECHARGED, [this](const SDL_UserEvent& event) { OnSDLUserEvent(event); });
     }
     ~Warp() {
       for (size_t i = 0; i < _charges.size(); i++) {
@@ -122,6 +125,7 @@ namespace UCI {
 
     private:
     std::vector<PowerUpCharge*> _charges;
+    CoffeeMaker::EventSubscription _recharged;
     static constexpr int enabledDuration = 250;
     static constexpr int cooldownDuration = 5000;
     static const std::string soundFileName;
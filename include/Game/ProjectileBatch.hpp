@@ -0,0 +1,49 @@
+#ifndef _game_projectilebatch_hpp
+#define _game_projectilebatch_hpp
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Batch kernels for advancing projectiles stored as parallel arrays. Integrate picks the widest
+ * instruction set the translation unit was compiled for, AVX, then SSE2, then plain scalar code.
+ */
+namespace ProjectileBatch {
+  /**
+   * @brief Projectile extents and the visible area, a projectile that leaves the visible area is cleared from the
+   * alive mask.
+   */
+  struct Bounds {
+    float width;
+    float height;
+    float outputWidth;
+    float outputHeight;
+  };
+
+  /**
+   * @brief Advances count projectiles by deltaTime and clears the alive flag of every projectile that ends up off
+   * screen. Flags that are already clear stay clear, the resulting mask is what the caller reloads.
+   *
+   * @param x
+   * @param y
+   * @param velocityX velocity in pixels per second
+   * @param velocityY velocity in pixels per second
+   * @param alive 1 for live projectiles, 0 for projectiles to reload
+   * @param count
+   * @param deltaTime
+   * @param bounds
+   */
+  void Integrate(float* x, float* y, const float* velocityX, const float* velocityY, std::uint8_t* alive,
+                 size_t count, float deltaTime, const Bounds& bounds);
+  /**
+   * @brief Scalar reference implementation of Integrate.
+   */
+  void IntegrateScalar(float* x, float* y, const float* velocityX, const float* velocityY, std::uint8_t* alive,
+                       size_t count, float deltaTime, const Bounds& bounds);
+  /**
+   * @brief Name of the instruction set Integrate was compiled with, ie: "AVX", "SSE2" or "Scalar".
+   */
+  const char* InstructionSet();
+}  // namespace ProjectileBatch
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef _game_projectilesystem_hpp
+#define _game_projectilesystem_hpp
+
+#include <SDL2/SDL.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Audio.hpp"
+#include "Game/Collider.hpp"
+#include "Texture.hpp"
+#include "Utilities.hpp"
+
+/**
+ * @brief Owns every live projectile in the scene. Projectile state is kept in parallel arrays so that
+ * all projectiles are integrated in one loop, hit tested against the active colliders in bulk and
+ * rendered grouped by texture. Projectiles do not own colliders of their own, hits are reported to
+ * the collider that was hit through Collider::QueueContact with a shared proxy collider of the projectile's type.
+ * Contacts are dispatched once per pair, so a collider hit by several projectiles of the same type within one
+ * update receives a single OnCollision, each of those projectiles is still reloaded.
+ */
+class ProjectileSystem {
+  public:
+  enum class Type { Friendly, Hostile };
+  enum class Size { Large, Small };
+  static constexpr size_t MAX_PROJECTILES = 4096;
+
+  /**
+   * @brief Loads the projectile textures and sounds and reserves storage for MAX_PROJECTILES.
+   * Safe to call more than once.
+   */
+  static void Init();
+  /**
+   * @brief Reloads every projectile and releases the textures and sounds.
+   */
+  static void Destroy();
+  /**
+   * @brief Sets the area projectiles are reloaded once they leave, Init sets it to the renderer output size.
+   */
+  static void SetBounds(float outputWidth, float outputHeight);
+
+  /**
+   * @brief Fires a projectile from the given position heading in the direction of the given rotation.
+   *
+   * @param colliderType Collider::Type the projectile hits as
+   * @param type
+   * @param size
+   * @param x
+   * @param y
+   * @param rotation heading in degrees
+   * @return true if the projectile was fired, false when the system is full
+   */
+  static bool Fire(Collider::Type colliderType, Type type, Size size, float x, float y, double rotation);
+  /**
+   * @brief Fires a projectile from the given position towards an explicit end position.
+   *
+   * @param colliderType Collider::Type the projectile hits as
+   * @param type
+   * @param size
+   * @param x
+   * @param y
+   * @param endX
+   * @param endY
+   * @param rotation rotation the projectile is rendered with, in degrees
+   * @return true if the projectile was fired, false when the system is full
+   */
+  static bool FireAt(Collider::Type colliderType, Type type, Size size, float x, float y, float endX, float endY,
+                     double rotation);
+  static void Update(float deltaTime);
+  static void Render();
+  /**
+   * @brief Removes every live projectile of the given collider type.
+   */
+  static void ReloadAll(Collider::Type colliderType);
+  static size_t Count();
+
+  private:
+  static constexpr size_t NUM_TEXTURES = 4;
+  static constexpr float SPEED = 500.0f;
+
+  static bool Spawn(Collider::Type colliderType, Type type, Size size, float x, float y, float directionX,
+                    float directionY, double rotation);
+  static void Integrate(float deltaTime);
+  static void HitTest();
+  static void Compact();
+  static Collider* Proxy(Collider::Type colliderType);
+
+  static std::vector<float> _x;
+  static std::vector<float> _y;
+  static std::vector<float> _velocityX;
+  static std::vector<float> _velocityY;
+  static std::vector<float> _rotation;
+  static std::vector<std::uint8_t> _texture;
+  static std::vector<std::uint8_t> _alive;
+  static std::vector<Collider::Type> _colliderType;
+  static std::array<Ref<CoffeeMaker::Texture>, NUM_TEXTURES> _textures;
+  static Ref<CoffeeMaker::AudioElement> _fireSound;
+  static Ref<CoffeeMaker::AudioElement> _impactSound;
+  static std::array<Scope<Collider>, Collider::NUM_TYPES> _proxies;
+  static float _width;
+  static float _height;
+  static float _speed;
+  static float _outputWidth;
+  static float _outputHeight;
+  static float _lastDeltaTime;
+};
+
+#endif
@@ -6,6 +6,8 @@
 #include <string>
 #include <vector>
 
+#include "CoroutineScheduler.hpp"
+#include "ECS/World.hpp"
 #include "Event.hpp"
 
 class SceneManager;
@@ -23,6 +25,16 @@ class Scene : public CoffeeMaker::IUserEventListener {
   virtual void Unpause() = 0;
   virtual bool IsLoaded();
   bool IsPaused();
+  /**
+   * @brief Resumes the gameplay scripts started by this scene. It is the current scheduler while the scene is
+   * loaded, and its waiting scripts are destroyed along with the scene.
+   */
+  CoffeeMaker::CoroutineScheduler* Scheduler();
+  /**
+   * @brief Entities of this scene, it is the current world while the scene is loaded. Their sprites and colliders
+   * are moved to their transforms after every Update.
+   */
+  CoffeeMaker::ECS::World* World();
 
   friend class SceneManager;
 
@@ -40,6 +52,8 @@ class Scene : public CoffeeMaker::IUserEventListener {
   protected:
   bool _loaded;
   bool _paused;
+  CoffeeMaker::CoroutineScheduler _scheduler;
+  CoffeeMaker::ECS::World _world;
 };
 
 class SceneManager {
@@ -54,6 +68,10 @@ class SceneManager {
   static void DestroyAllScenes();
   static void DestroyCurrentScene();
   static bool CurrentScenePaused();
+  /**
+   * @brief Resumes the scripts of the current scene waiting on this event.
+   */
+  static void DispatchUserEvent(const SDL_UserEvent& event);
   static bool IsInit();
 
   static std::vector<Scene*> scenes;
@@ -8,6 +8,7 @@
 
 #include "Async.hpp"
 #include "Audio.hpp"
+#include "EventBus.hpp"
 #include "Game/Echelon.hpp"
 #include "Game/Enemy.hpp"
 #include "Game/Entity.hpp"
@@ -45,6 +46,7 @@ class MainScene : public Scene {
   Scope<CoffeeMaker::Async::IntervalTask> _enemySpawnTask;
   Echelon* _backEchelon;
   Echelon* _frontEchelon;
+  CoffeeMaker::EventSubscriptions _subscriptions;
 };
 
 #endif
@@ -26,6 +26,7 @@ class SplinePoint : public CoffeeMaker::IMouseListener {
       _knot(0.0) {}
   ~SplinePoint() = default;
   void Render() {
+    CoffeeMaker::Renderer::Flush();
     if (_selected) {
       SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), 255, 255, 0, 255);
       SDL_RenderFillRectF(CoffeeMaker::Renderer::Instance(), &_rect);
@@ -3,6 +3,7 @@
 
 #include "Coroutine.hpp"
 #include "Event.hpp"
+#include "EventBus.hpp"
 #include "File.hpp"
 #include "Utilities.hpp"
 
@@ -12,7 +13,7 @@ struct HighScores {
   unsigned int thirdPlace;
 };
 
-class ScoreManager : public CoffeeMaker::IUserEventListener {
+class ScoreManager {
   public:
   enum Multiplier { Standard = -1, Super = 2, Extreme = 5 };
 
@@ -27,7 +28,7 @@ class ScoreManager : public CoffeeMaker::IUserEventListener {
   static void ResetScore();
   static void SetNewHighScore(unsigned int pos, unsigned int score);
 
-  void OnSDLUserEvent(const SDL_UserEvent& event) override;
+  void OnSDLUserEvent(const SDL_UserEvent& event);
 
   protected:
   ScoreManager();
@@ -42,6 +43,7 @@ class ScoreManager : public CoffeeMaker::IUserEventListener {
   unsigned int _score;
   HighScores _highScores;
   CoffeeMaker::File _scoreFile;
+  CoffeeMaker::EventSubscription _incrementScore;
 };
 
 #endif
@@ -0,0 +1,99 @@
+#ifndef _game_spatialgrid_hpp
+#define _game_spatialgrid_hpp
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Uniform grid broadphase. The grid is rebuilt from scratch every frame from a flat array of rects,
+ * each rect is bucketed into every cell it overlaps and only rects sharing a cell are tested against each other.
+ * All storage is reused between builds, so a steady state frame does not allocate.
+ */
+class SpatialGrid {
+  public:
+  /**
+   * @brief Upper bound on cells along either axis, cells grow past the requested size when the rects span
+   * more area than this can cover.
+   */
+  static constexpr int MAX_CELLS_PER_AXIS = 64;
+
+  explicit SpatialGrid(float cellSize = 128.0f);
+
+  /**
+   * @brief Buckets the given rects into the grid. Indices reported by ForEachPair refer to this array, which
+   * must stay alive and unchanged until the next Build.
+   *
+   * @param rects
+   * @param count
+   * @param layers optional layer bit of each rect
+   * @param masks optional mask of layers each rect collides with, pairs whose masks exclude each other are
+   * skipped before any overlap test. Masks are expected to be symmetric. Layers are only used when masks are given.
+   */
+  void Build(const SDL_FRect* rects, size_t count, const std::uint32_t* layers = nullptr,
+             const std::uint32_t* masks = nullptr);
+
+  /**
+   * @brief Invokes fn(i, j) once for every pair of overlapping rects whose layers interact, where i < j.
+   */
+  template <typename F>
+  void ForEachPair(F&& fn) const {
+    for (int cell = 0; cell < _columns * _rows; cell++) {
+      std::uint32_t begin = _cellStart[cell];
+      std::uint32_t end = _cellStart[cell + 1];
+      for (std::uint32_t a = begin; a < end; a++) {
+        std::uint32_t i = _cellEntries[a];
+        for (std::uint32_t b = a + 1; b < end; b++) {
+          std::uint32_t j = _cellEntries[b];
+          if (_layers != nullptr && _masks != nullptr && (_masks[i] & _layers[j]) == 0) {
+            continue;
+          }
+          if (!Overlaps(_rects[i], _rects[j])) {
+            continue;
+          }
+          // NOTE: a pair spanning several shared cells is only reported by the cell holding the top left corner
+          // of their intersection.
+          float x = _rects[i].x > _rects[j].x ? _rects[i].x : _rects[j].x;
+          float y = _rects[i].y > _rects[j].y ? _rects[i].y : _rects[j].y;
+          if (CellIndex(Column(x), Row(y)) != cell) {
+            continue;
+          }
+          if (i < j) {
+            fn(i, j);
+          } else {
+            fn(j, i);
+          }
+        }
+      }
+    }
+  }
+
+  static bool Overlaps(const SDL_FRect& a, const SDL_FRect& b) {
+    return a.x < b.x + b.w && a.x + a.w > b.x && a.y < b.y + b.h && a.y + a.h > b.y;
+  }
+
+  int Columns() const;
+  int Rows() const;
+
+  private:
+  int Column(float x) const;
+  int Row(float y) const;
+  int CellIndex(int column, int row) const { return row * _columns + column; }
+
+  float _cellSize;
+  float _cellWidth;
+  float _cellHeight;
+  float _originX;
+  float _originY;
+  int _columns;
+  int _rows;
+  const SDL_FRect* _rects;
+  const std::uint32_t* _layers;
+  const std::uint32_t* _masks;
+  std::vector<std::uint32_t> _cellStart;
+  std::vector<std::uint32_t> _cellEntries;
+};
+
+#endif
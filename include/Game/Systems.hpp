@@ -0,0 +1,18 @@
+#ifndef _game_systems_hpp
+#define _game_systems_hpp
+
+#include "ECS/World.hpp"
+
+namespace UCI {
+  namespace Systems {
+
+    /**
+     * @brief Moves every sprite and collider to its entity's transform. Runs once a simulation step, after the
+     * scene updated, so the physics step and the render both see where the entities ended up.
+     */
+    void SyncTransforms(CoffeeMaker::ECS::World& world);
+
+  }  // namespace Systems
+}  // namespace UCI
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef _coffeemaker_glyphatlas_hpp
+#define _coffeemaker_glyphatlas_hpp
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "TextureRegistry.hpp"
+#include "Utilities.hpp"
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief A glyph laid out by GlyphAtlas::Layout. The destination is relative to the top left corner of the text.
+   */
+  struct PlacedGlyph {
+    SDL_Texture* texture;
+    SDL_Rect source;
+    SDL_FRect destination;
+  };
+
+  /**
+   * @brief Rasterizes the glyphs of every font in use once, in white, onto atlas pages shared by all the text drawn
+   * with that font. Strings are laid out from the cached glyphs as quads for Renderer::DrawSprite, which tints them,
+   * so changing a string or its color neither renders a surface nor creates a texture.
+   * Fonts are looked up by their TTF_Font, the FontManager opens one per name and size. Text is read a byte per
+   * glyph, as TTF_RenderText does.
+   */
+  class GlyphAtlas {
+    public:
+    static constexpr int PAGE_SIZE = 512;
+    /**
+     * @brief Transparent gutter around each glyph so filtering never samples a neighbour.
+     */
+    static constexpr int PADDING = 1;
+    /**
+     * @brief Glyphs rasterized as soon as a font is first used, the printable ASCII range.
+     */
+    static constexpr unsigned char FIRST_PRELOADED = ' ';
+    static constexpr unsigned char LAST_PRELOADED = '~';
+
+    /**
+     * @brief Bytes [begin, end) of a string that fit on one line, and how wide they are.
+     */
+    struct Line {
+      size_t begin;
+      size_t end;
+      int width;
+    };
+
+    /**
+     * @brief Splits text into lines at every newline, and wraps lines wider than wrapLength at their last space.
+     * Words wider than wrapLength on their own are split where they overflow. The space a line is wrapped at belongs
+     * to neither line.
+     *
+     * @param text
+     * @param advances 256 horizontal advances in pixels, indexed by byte
+     * @param wrapLength in pixels, 0 to only split at newlines
+     * @param lines replaced with at least one line
+     */
+    static void BreakLines(const std::string& text, const int* advances, int wrapLength, std::vector<Line>& lines);
+
+    /**
+     * @brief Lays out text as one quad per visible glyph, rasterizing any glyph of the font that is not in the atlas
+     * yet. Must be called after the Renderer is created.
+     *
+     * @param font
+     * @param text
+     * @param wrapLength in pixels, see BreakLines
+     * @param glyphs replaced with the quads of the text
+     * @return SDL_Point width and height of the laid out text
+     */
+    static SDL_Point Layout(TTF_Font* font, const std::string& text, Uint32 wrapLength,
+                            std::vector<PlacedGlyph>& glyphs);
+
+    /**
+     * @brief Releases every page. Text laid out before must not be drawn afterwards.
+     */
+    static void Destroy();
+    static size_t NumFonts();
+    /**
+     * @brief Number of glyphs rasterized since start up.
+     */
+    static size_t Rasterized();
+
+    private:
+    struct Glyph {
+      bool rasterized;
+      size_t page;
+      /**
+       * @brief Empty for glyphs with nothing to draw, ie: spaces.
+       */
+      SDL_Rect rect;
+    };
+
+    struct Cache {
+      std::array<Glyph, 256> glyphs;
+      std::array<int, 256> advances;
+      std::vector<Ref<TextureAsset>> pages;
+      int lineSkip;
+      int height;
+      // NOTE: shelf packing cursor on the last page
+      int x;
+      int y;
+      int shelf;
+    };
+
+    static Cache& Use(TTF_Font* font);
+    static const Glyph& Rasterize(Cache& cache, TTF_Font* font, unsigned char byte);
+    static void AddPage(Cache& cache);
+
+    static std::unordered_map<TTF_Font*, Cache> _caches;
+    static std::vector<Line> _lines;
+    static size_t _rasterized;
+  };
+
+}  // namespace CoffeeMaker
+
+#endif
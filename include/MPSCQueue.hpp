@@ -0,0 +1,207 @@
+#ifndef _coffeemaker_mpscqueue_hpp
+#define _coffeemaker_mpscqueue_hpp
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace CoffeeMaker {
+  namespace Async {
+
+    /**
+     * @brief Bounded queue any number of threads push to and a single thread, the main thread, drains.
+     *
+     * Pushing into the ring is lock free: a producer claims a slot with a compare and swap on the head and
+     * publishes it through the slot's sequence number. Nothing pushed is ever dropped, once the ring is full
+     * messages spill into a mutex guarded overflow list until the next drain. HighWater and Overflows tell how
+     * close the ring came to its capacity, and how often it did not fit.
+     */
+    template <typename T>
+    class MPSCQueue {
+      public:
+      /**
+       * @param capacity rounded up to a power of two
+       */
+      explicit MPSCQueue(size_t capacity) :
+          _capacity(RoundUp(capacity)),
+          _mask(_capacity - 1),
+          _cells(std::make_unique<Cell[]>(_capacity)),
+          _head(0),
+          _tail(0),
+          _highWater(0),
+          _spilled(false),
+          _overflowMutex(),
+          _overflow(),
+          _overflows(0) {
+        for (size_t i = 0; i < _capacity; i++) {
+          _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+      }
+      MPSCQueue(const MPSCQueue&) = delete;
+      MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+      /**
+       * @brief Pushes into the ring, value is left untouched when the ring is full. Safe to call from any thread.
+       */
+      template <typename U>
+      bool TryPush(U&& value) {
+        size_t position = _head.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+          cell = &_cells[position & _mask];
+          const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+          const std::intptr_t difference =
+              static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+          if (difference == 0) {
+            if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+              break;
+            }
+          } else if (difference < 0) {
+            // NOTE: the consumer has not freed this slot yet, the ring is full
+            return false;
+          } else {
+            position = _head.load(std::memory_order_relaxed);
+          }
+        }
+        cell->value = std::forward<U>(value);
+        // NOTE: measured before publishing, the consumer cannot pop past this slot until then, so tail <= position
+        RaiseHighWater(position + 1 - _tail.load(std::memory_order_acquire));
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+
+      /**
+       * @brief Pushes into the ring, or the overflow list when the ring is full. Safe to call from any thread.
+       */
+      template <typename U>
+      void Push(U&& value) {
+        // NOTE: once something spilled the rest follows it, so messages from one thread keep their order
+        if (!_spilled.load(std::memory_order_acquire) && TryPush(std::forward<U>(value))) {
+          return;
+        }
+        std::lock_guard<std::mutex> lock(_overflowMutex);
+        _overflow.emplace_back(std::forward<U>(value));
+        _spilled.store(true, std::memory_order_release);
+        _overflows.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      /**
+       * @brief Pops the oldest message of the ring. Consumer thread only.
+       *
+       * @return false when the ring is empty, or its oldest slot is still being written
+       */
+      bool TryPop(T& value) {
+        const size_t position = _tail.load(std::memory_order_relaxed);
+        Cell& cell = _cells[position & _mask];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1) < 0) {
+          return false;
+        }
+        value = std::move(cell.value);
+        // NOTE: reset so a slot does not keep whatever the message owned alive until it is reused
+        cell.value = T();
+        cell.sequence.store(position + _capacity, std::memory_order_release);
+        _tail.store(position + 1, std::memory_order_release);
+        return true;
+      }
+
+      /**
+       * @brief Hands every message pushed before the call to fn, oldest first. Messages pushed while draining,
+       * including the ones fn pushes itself, wait for the next drain. Consumer thread only.
+       *
+       * @return number of messages drained
+       */
+      template <typename F>
+      size_t Drain(F&& fn) {
+        // NOTE: a producer only spills after its earlier pushes claimed their slot, so every ring message older than
+        // the swapped overflow is below head. Pushes that see the reset claim slots past head and wait for the next
+        // drain, behind this overflow.
+        size_t head;
+        std::vector<T> overflow;
+        if (_spilled.load(std::memory_order_acquire)) {
+          std::lock_guard<std::mutex> lock(_overflowMutex);
+          head = _head.load(std::memory_order_acquire);
+          overflow.swap(_overflow);
+          _spilled.store(false, std::memory_order_release);
+        } else {
+          head = _head.load(std::memory_order_acquire);
+        }
+
+        size_t drained = 0;
+        T value;
+        while (_tail.load(std::memory_order_relaxed) != head) {
+          if (TryPop(value)) {
+            fn(std::move(value));
+            drained++;
+          } else {
+            // NOTE: the slot is claimed but its producer is still writing it
+            std::this_thread::yield();
+          }
+        }
+        for (T& spilled : overflow) {
+          fn(std::move(spilled));
+        }
+        return drained + overflow.size();
+      }
+
+      /**
+       * @brief Messages waiting in the ring, not counting the overflow list.
+       */
+      size_t Size() const {
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        const size_t head = _head.load(std::memory_order_acquire);
+        return head > tail ? std::min(head - tail, _capacity) : 0;
+      }
+      size_t Capacity() const { return _capacity; }
+      /**
+       * @brief Most messages ever waiting in the ring at once.
+       */
+      size_t HighWater() const { return _highWater.load(std::memory_order_relaxed); }
+      /**
+       * @brief Messages that did not fit in the ring since the queue was created.
+       */
+      size_t Overflows() const { return _overflows.load(std::memory_order_relaxed); }
+
+      private:
+      struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+      };
+
+      static size_t RoundUp(size_t capacity) {
+        size_t rounded = 2;
+        while (rounded < capacity) {
+          rounded <<= 1;
+        }
+        return rounded;
+      }
+
+      void RaiseHighWater(size_t size) {
+        size_t highWater = _highWater.load(std::memory_order_relaxed);
+        while (size > highWater && !_highWater.compare_exchange_weak(highWater, size, std::memory_order_relaxed)) {
+        }
+      }
+
+      const size_t _capacity;
+      const size_t _mask;
+      std::unique_ptr<Cell[]> _cells;
+      // NOTE: producers hammer the head and the consumer the tail, each gets a cache line of its own
+      alignas(64) std::atomic<size_t> _head;
+      alignas(64) std::atomic<size_t> _tail;
+      alignas(64) std::atomic<size_t> _highWater;
+      std::atomic<bool> _spilled;
+      std::mutex _overflowMutex;
+      std::vector<T> _overflow;
+      std::atomic<size_t> _overflows;
+    };
+
+  }  // namespace Async
+}  // namespace CoffeeMaker
+
+#endif
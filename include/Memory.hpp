@@ -0,0 +1,30 @@
+#ifndef _coffeemaker_memory_hpp
+#define _coffeemaker_memory_hpp
+
+#include <cstdint>
+
+namespace CoffeeMaker {
+
+  namespace Memory {
+    /**
+     * @brief Number of heap allocations made through the global operator new since start up, on any thread.
+     * Over-aligned allocations are not counted.
+     *
+     * @return std::uint64_t
+     */
+    std::uint64_t Allocations();
+    /**
+     * @brief Closes the current frame, called once per frame by the main loop.
+     */
+    void EndFrame();
+    /**
+     * @brief Allocations made between the last two calls to EndFrame.
+     *
+     * @return std::uint64_t
+     */
+    std::uint64_t LastFrameAllocations();
+  }  // namespace Memory
+
+}  // namespace CoffeeMaker
+
+#endif
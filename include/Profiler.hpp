@@ -0,0 +1,183 @@
+#ifndef _coffeemaker_profiler_hpp
+#define _coffeemaker_profiler_hpp
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief A zone that was entered and left on one thread. Times are in nanoseconds since the profiler started.
+   */
+  struct ProfileEvent {
+    const char* name;
+    std::uint64_t start;
+    std::uint64_t end;
+    std::uint32_t depth;
+    std::uint32_t thread;
+  };
+
+  /**
+   * @brief Every event of one zone in a frame added together.
+   */
+  struct ZoneStats {
+    const char* name;
+    std::uint32_t depth;
+    /**
+     * @brief Start of the earliest call.
+     */
+    std::uint64_t first;
+    std::uint32_t calls;
+    std::uint64_t totalNs;
+    std::uint64_t maxNs;
+  };
+
+  /**
+   * @brief Single producer, single consumer ring of events. The owning thread pushes as zones close and the main
+   * thread drains it once per frame, neither side takes a lock. Events pushed while the ring is full are dropped.
+   */
+  class ProfileBuffer {
+    public:
+    static constexpr size_t CAPACITY = 1 << 13;
+
+    explicit ProfileBuffer(std::uint32_t thread);
+
+    /**
+     * @brief Only called from the owning thread.
+     *
+     * @return false if the ring was full and the event was dropped
+     */
+    bool Push(const ProfileEvent& event);
+    /**
+     * @brief Hands every pending event to consume, oldest first. Only called from the main thread.
+     */
+    template <typename F>
+    void Drain(F&& consume) {
+      size_t tail = _tail.load(std::memory_order_relaxed);
+      const size_t head = _head.load(std::memory_order_acquire);
+      for (; tail != head; tail++) {
+        consume(_events[tail & (CAPACITY - 1)]);
+      }
+      _tail.store(tail, std::memory_order_release);
+    }
+    std::uint32_t Thread() const;
+    std::uint64_t Dropped() const;
+
+    private:
+    std::array<ProfileEvent, CAPACITY> _events;
+    std::uint32_t _thread;
+    alignas(64) std::atomic<size_t> _head;
+    alignas(64) std::atomic<size_t> _tail;
+    std::atomic<std::uint64_t> _dropped;
+  };
+
+  /**
+   * @brief Collects the zones recorded by CM_PROFILE_SCOPE on every thread.
+   *
+   * EndFrame is called once per frame by the main loop. It sums the zones of the frame into LastFrame, logs them
+   * when the frame went over the spike threshold and, while capturing, keeps the raw events for a Chrome trace
+   * (chrome://tracing or https://ui.perfetto.dev).
+   */
+  class Profiler {
+    public:
+    static constexpr size_t DEFAULT_CAPTURE_EVENTS = 1 << 20;
+
+    /**
+     * @brief Nanoseconds since the profiler started.
+     */
+    static std::uint64_t Now();
+    /**
+     * @brief The ring of the calling thread, created the first time a thread records a zone.
+     */
+    static ProfileBuffer* ThreadBuffer();
+
+    /**
+     * @brief Drains every thread and closes the current frame.
+     */
+    static void EndFrame();
+    /**
+     * @brief Zones of the last frame in the order they were first closed.
+     */
+    static const std::vector<ZoneStats>& LastFrame();
+    static std::uint64_t LastFrameNs();
+    static std::uint64_t FrameCount();
+    /**
+     * @brief Frames that take longer than the threshold have their zones logged, 0 turns it off.
+     */
+    static void SetSpikeThreshold(double milliseconds);
+    /**
+     * @brief Events lost to full rings on every thread.
+     */
+    static std::uint64_t Dropped();
+
+    /**
+     * @brief Keeps raw events from now on, up to maxEvents.
+     */
+    static void StartCapture(size_t maxEvents = DEFAULT_CAPTURE_EVENTS);
+    static void StopCapture();
+    static bool Capturing();
+    static size_t NumCapturedEvents();
+    /**
+     * @brief The captured events in the Chrome trace event format.
+     */
+    static std::string ChromeTrace();
+    static bool WriteChromeTrace(const std::string& filePath);
+
+    /**
+     * @brief Drops all aggregated and captured data, ie: between tests.
+     */
+    static void Reset();
+
+    private:
+    static void Aggregate(const ProfileEvent& event);
+    static void LogFrame();
+
+    static std::mutex _buffersMutex;
+    static std::vector<std::unique_ptr<ProfileBuffer>> _buffers;
+    static std::vector<ZoneStats> _lastFrame;
+    static std::uint64_t _frameStart;
+    static std::uint64_t _lastFrameNs;
+    static std::uint64_t _frameCount;
+    static std::uint64_t _spikeThresholdNs;
+    static bool _capturing;
+    static size_t _maxCaptureEvents;
+    static std::vector<ProfileEvent> _capture;
+  };
+
+  /**
+   * @brief Records the time between its construction and destruction as a zone, nested in any zone open on the same
+   * thread. Use it through CM_PROFILE_SCOPE so it compiles away without COFFEEMAKER_PROFILING.
+   */
+  class ProfileZone {
+    public:
+    /**
+     * @param name must outlive the profiler, ie: a string literal
+     */
+    explicit ProfileZone(const char* name);
+    ~ProfileZone();
+
+    private:
+    const char* _name;
+    std::uint64_t _start;
+    std::uint32_t _depth;
+  };
+
+}  // namespace CoffeeMaker
+
+#define CM_PROFILE_CONCAT_INNER(a, b) a##b
+#define CM_PROFILE_CONCAT(a, b) CM_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef COFFEEMAKER_PROFILING
+#define CM_PROFILE_SCOPE(name) CoffeeMaker::ProfileZone CM_PROFILE_CONCAT(_cmProfileZone, __LINE__)(name)
+#define CM_PROFILE_FRAME() CoffeeMaker::Profiler::EndFrame()
+#else
+#define CM_PROFILE_SCOPE(name)
+#define CM_PROFILE_FRAME()
+#endif
+
+#endif
@@ -3,6 +3,8 @@
 
 #include <SDL2/SDL.h>
 
+#include <vector>
+
 #include "Window.hpp"
 
 namespace CoffeeMaker {
@@ -14,7 +16,14 @@ namespace CoffeeMaker {
 
   class Renderer {
     public:
-    Renderer();
+    static constexpr Uint32 DEFAULT_FLAGS = SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC;
+
+    /**
+     * @brief Creates the renderer for the global window, if it does not exist yet.
+     *
+     * @param flags SDL_RendererFlags, ie: SDL_RENDERER_SOFTWARE for machines without a GPU
+     */
+    explicit Renderer(Uint32 flags = DEFAULT_FLAGS);
     ~Renderer();
 
     static SDL_Renderer *Instance();
@@ -31,6 +40,43 @@ namespace CoffeeMaker {
      */
     static Uint32 DrawCalls();
     static void IncDrawCalls();
+    /**
+     * @brief The number of vertices submitted through sprite batches so far in the current frame.
+     *
+     * @return Uint32
+     */
+    static Uint32 Vertices();
+    /**
+     * @brief The number of sprites queued through DrawSprite so far in the current frame.
+     *
+     * @return Uint32
+     */
+    static Uint32 Sprites();
+    /**
+     * @brief Queues a textured quad. Consecutive quads that share a texture are drawn with a single
+     * SDL_RenderGeometry call once the texture changes, Flush is called or the frame ends.
+     *
+     * @param texture
+     * @param source sub-rect of the texture in pixels
+     * @param destination
+     * @param rotation degrees clockwise around the center of destination
+     * @param flip
+     * @param color multiplied into the texture, per quad so tinted quads still share a batch
+     */
+    static void DrawSprite(SDL_Texture *texture, const SDL_Rect &source, const SDL_FRect &destination,
+                           double rotation = 0.0, SDL_RendererFlip flip = SDL_FLIP_NONE,
+                           const SDL_Color &color = SDL_Color{255, 255, 255, 255});
+    /**
+     * @brief The vertices queued by DrawSprite since the last Flush, four per quad.
+     *
+     * @return const std::vector<SDL_Vertex>&
+     */
+    static const std::vector<SDL_Vertex> &QueuedVertices();
+    /**
+     * @brief Draws every queued quad. Anything that draws through SDL directly, or changes the color, alpha or blend
+     * mode of a texture, must flush first to keep the draw order.
+     */
+    static void Flush();
     /**
      * @brief Returns the entire available render height. Scales accordingly to High DPI modes
      *
@@ -71,6 +117,13 @@ namespace CoffeeMaker {
     static int _width;
     static int _height;
     static SDL_BlendMode _blendMode;
+    static Uint32 _numVertices;
+    static Uint32 _numSprites;
+    static std::vector<SDL_Vertex> _vertices;
+    static std::vector<int> _indices;
+    static SDL_Texture *_batchTexture;
+    static float _batchTextureWidth;
+    static float _batchTextureHeight;
   };
 
   class GlobalRenderer {
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "BakedSpline.hpp"
 #include "Math.hpp"
 #include "Utilities.hpp"
 #include "tinysplinecxx.h"
@@ -14,6 +15,11 @@ namespace CoffeeMaker {
    */
   class BSpline {
     public:
+    /**
+     * @brief Segments the curve is split into by BakeArcLength, and by the CoffeeMakerSplineBaker tool.
+     */
+    static constexpr size_t ARC_LENGTH_SAMPLES = 256;
+
     BSpline(size_t numControlPoints = 4);
     ~BSpline();
 
@@ -57,11 +63,60 @@ namespace CoffeeMaker {
 
     /**
      * @brief Returns a Point2D based on a given knot value clamped between 0.0 and 1.0
+     * Evaluated with De Boor's algorithm on a copy of the knots and control points, which is only refreshed after they
+     * change, so following a spline every frame does not allocate.
      * @param knot double value clamped between 0.0 and 1.0
      * @return CoffeeMaker::Math::Point2D
      */
     CoffeeMaker::Math::Point2D Point2DAtKnot(tinyspline::real knot);
 
+    /**
+     * @brief Returns the Point2D a given fraction of the way along the curve, measured by arc length and clamped
+     * between 0.0 and 1.0, so following it with a steadily growing fraction moves at a constant speed.
+     * Looked up with a binary search and a lerp in a table baked once after the control points change, see
+     * BakeArcLength.
+     * @param fraction float value clamped between 0.0 and 1.0
+     * @return CoffeeMaker::Math::Point2D
+     */
+    CoffeeMaker::Math::Point2D Point2DAtDistance(float fraction);
+
+    /**
+     * @brief Samples the curve at evenly spaced knots and stores the distance travelled up to every sample.
+     * Done on demand by Point2DAtDistance and Length, call it up front to keep the work out of a frame.
+     *
+     * @param samples number of segments the curve is split into
+     */
+    void BakeArcLength(size_t samples = ARC_LENGTH_SAMPLES);
+
+    /**
+     * @brief Length of the curve, as measured by the baked arc length table.
+     *
+     * @return float
+     */
+    float Length();
+
+    /**
+     * @brief Bakes the arc length table, see BakeArcLength, and returns a copy of it no later change to this spline
+     * affects.
+     *
+     * @param samples number of segments the curve is split into
+     * @return BakedSpline
+     */
+    BakedSpline Bake(size_t samples = ARC_LENGTH_SAMPLES);
+
+    /**
+     * @brief Loads the arc length table of a .spline asset from the .bspline file baked next to it at build time,
+     * see SplineAsset, or bakes the .spline itself when there is none. Blocks, run it on the ThreadPool. Failures
+     * are returned rather than reported, the caller reports them from the main thread.
+     *
+     * @param filePath of the .spline asset, relative to the assets directory
+     * @param width of the screen the curve is remapped to, see RemapControlPoints
+     * @param height of the screen the curve is remapped to
+     * @param baked set to the loaded table
+     * @return false if neither the .bspline nor the .spline could be read, baked is left untouched
+     */
+    static bool LoadBaked(const std::string& filePath, float width, float height, BakedSpline& baked);
+
     void SetKnotAt(size_t index, tinyspline::real knot);
 
     std::vector<tinyspline::real> GetKnots() const { return _tinysplineBSpline->knots(); }
@@ -76,9 +131,26 @@ namespace CoffeeMaker {
     void RemapControlPoints();
 
     private:
+    static constexpr size_t MAX_EVAL_DEGREE = 7;
+
+    /**
+     * @brief Reads the whitespace separated x y pairs of a .spline file. Safe to call from any thread.
+     *
+     * @return false if the file could not be read or does not hold at least one whole point
+     */
+    static bool ReadControlPoints(const std::string& fullFilePath, std::vector<tinyspline::real>& points);
+
+    void CacheEvaluation();
+
     std::vector<CoffeeMaker::Math::Point2D> _cache;
     Scope<tinyspline::BSpline> _tinysplineBSpline;
     std::vector<CoffeeMaker::Math::Point2D> _curves;
+    std::vector<tinyspline::real> _evalKnots;
+    std::vector<tinyspline::real> _evalPoints;
+    size_t _evalDegree;
+    bool _evalDirty;
+    BakedSpline _arc;
+    bool _arcDirty;
   };
 
   /**
@@ -5,6 +5,7 @@
 
 #include <string>
 
+#include "FixedTimestep.hpp"
 #include "Math.hpp"
 #include "Texture.hpp"
 #include "Utilities.hpp"
@@ -18,6 +19,9 @@ namespace CoffeeMaker {
 
     void Render();
     void Render(SDL_Rect clip);
+    /**
+     * @brief Moves the sprite. Rendering blends between the positions set in the last two simulation steps.
+     */
     void SetPosition(const CoffeeMaker::Math::Vector2D& pos);
     void SetAlpha(Uint8 alpha);
 
@@ -26,7 +30,13 @@ namespace CoffeeMaker {
     SDL_FRect clientRect;
 
     private:
+    /**
+     * @brief clientRect at the interpolated position, or clientRect itself if it was written to directly.
+     */
+    SDL_FRect RenderRect() const;
+
     Scope<CoffeeMaker::Texture> _texture;
+    CoffeeMaker::InterpolatedPoint _position;
   };
 }  // namespace CoffeeMaker
 
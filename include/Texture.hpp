@@ -6,16 +6,27 @@
 #include <string>
 
 #include "Color.hpp"
+#include "TextureRegistry.hpp"
+#include "Utilities.hpp"
 
 namespace CoffeeMaker {
   SDL_Texture *createRectTextureFromSurface(int height, int width, const SDL_Color &color);
 
+  /**
+   * @brief A drawable image. Textures loaded from the same file share one SDL_Texture, either a TextureAtlas page or
+   * a TextureRegistry entry. Color, alpha and blend mode are kept per Texture. Color and alpha tint the vertices of
+   * each quad, the blend mode is applied to the shared handle when rendering.
+   */
   class Texture {
     public:
     static constexpr SDL_Color COLOR_KEY = {.r = 213, .g = 57, .b = 213, .a = 255};
     Texture();
     explicit Texture(const std::string &filePath);
     explicit Texture(const SDL_Color &color);
+    /**
+     * Draws the whole of an already created texture, ie: one adopted through TextureRegistry::Adopt.
+     */
+    explicit Texture(Ref<TextureAsset> asset);
     /**
      * Load a texture from the given file path and use the given
      * color key to set transparent pixels.
@@ -48,18 +59,38 @@ namespace CoffeeMaker {
     void SetHeight(int const height);
     void SetWidth(int const width);
     SDL_Texture *Handle() const;
+    /**
+     * Sub-rect of Handle() holding this texture's image. Covers the whole handle unless the image was packed into the
+     * TextureAtlas.
+     */
+    const SDL_Rect &Region() const;
 
     static void SetTextureDirectory();
 
     private:
+    /**
+     * Sets this Texture's blend mode on the shared handle if another Texture changed it.
+     */
+    void Modulate();
+    /**
+     * This Texture's color and alpha, multiplied into the texture through the color of its vertices.
+     */
+    SDL_Color VertexColor() const;
+    /**
+     * Offsets a clip rect given relative to this texture's image into the handle.
+     */
+    SDL_Rect Source(const SDL_Rect &clip) const;
+
     static std::string _textureDirectory;
 
+    Ref<TextureAsset> _asset;
     SDL_Texture *_texture;
+    SDL_Rect _region;
     SDL_Color _color;
+    TextureModulation _modulation;
     int _height;
     int _width;
     bool _useColorKey;
-    SDL_Surface *_surface;
   };
 
 }  // namespace CoffeeMaker
@@ -0,0 +1,102 @@
+#ifndef _coffeemaker_textureatlas_hpp
+#define _coffeemaker_textureatlas_hpp
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "TextureRegistry.hpp"
+#include "Utilities.hpp"
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief A named sub-rect of an atlas page.
+   */
+  struct AtlasRegion {
+    Ref<TextureAsset> page;
+    SDL_Rect rect;
+  };
+
+  /**
+   * @brief Packs the small images under assets/images into a few large textures at start up, so that sprites drawn
+   * from different images share one SDL_Texture. Texture::LoadFromFile resolves to an atlas region whenever the
+   * requested file was packed, anything not packed keeps loading as its own texture.
+   */
+  class TextureAtlas {
+    public:
+    static constexpr int PAGE_SIZE = 1024;
+    /**
+     * @brief Images wider or taller than this are left out of the atlas, ie: tiled backgrounds.
+     */
+    static constexpr int MAX_REGION_SIZE = 256;
+    /**
+     * @brief Gutter around each region, filled by extruding the region's edge pixels so filtering never samples a
+     * neighbour.
+     */
+    static constexpr int PADDING = 1;
+
+    /**
+     * @brief Where Pack put an image. page is -1 for images that do not fit on a page.
+     */
+    struct Placement {
+      int page;
+      int x;
+      int y;
+    };
+
+    /**
+     * @brief Shelf packs the given sizes onto square pages, tallest first. Each placement is the top left corner of
+     * the image itself, the padding around it is reserved on every side.
+     *
+     * @param sizes width and height of each image
+     * @param pageSize
+     * @param padding
+     * @return one placement per size, in the same order
+     */
+    static std::vector<Placement> Pack(const std::vector<SDL_Point>& sizes, int pageSize, int padding);
+
+    /**
+     * @brief Packs every png under assets/images, looked up by their path relative to it. The magenta
+     * Texture::COLOR_KEY is baked in as transparency. Must be called after the Renderer is created.
+     */
+    static void Build();
+    /**
+     * @brief Releases the atlas. Textures already resolved to a region keep their page alive.
+     */
+    static void Destroy();
+    /**
+     * @brief Regions are color keyed, only look them up for textures that use Texture::COLOR_KEY.
+     * @return nullptr if the image was not packed
+     */
+    static const AtlasRegion* Find(const std::string& name);
+    static size_t NumPages();
+    static size_t NumRegions();
+
+    private:
+    struct Entry {
+      std::string name;
+      SDL_Surface* surface;
+    };
+
+    static void CollectEntries(const std::string& directory, const std::string& prefix, std::vector<Entry>& entries);
+    /**
+     * @brief Decodes an image into an RGBA32 surface with its color key made transparent. Safe to call from any
+     * thread.
+     *
+     * @return nullptr if it could not be loaded or is too large for the atlas
+     */
+    static SDL_Surface* LoadSurface(const std::filesystem::path& filePath);
+    static void BlitExtruded(SDL_Surface* image, SDL_Surface* page, int x, int y);
+
+    static std::unordered_map<std::string, AtlasRegion> _regions;
+    static std::vector<Ref<TextureAsset>> _pages;
+  };
+
+}  // namespace CoffeeMaker
+
+#endif
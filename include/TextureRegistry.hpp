@@ -0,0 +1,92 @@
+#ifndef _coffeemaker_textureregistry_hpp
+#define _coffeemaker_textureregistry_hpp
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "Utilities.hpp"
+
+namespace CoffeeMaker {
+
+  /**
+   * @brief Color, alpha and blend mode multiplied into render copy operations.
+   */
+  struct TextureModulation {
+    SDL_Color color;
+    Uint8 alpha;
+    SDL_BlendMode blendMode;
+
+    bool operator==(const TextureModulation& rhs) const;
+  };
+
+  /**
+   * @brief An image decoded and uploaded to the GPU once, shared by every Texture that loaded the same file.
+   * The SDL_Texture is destroyed when the last reference is released.
+   */
+  struct TextureAsset {
+    SDL_Texture* handle;
+    int width;
+    int height;
+    /**
+     * @brief Modulation the texture was created with, every Texture starts from it.
+     */
+    TextureModulation base;
+    /**
+     * @brief Modulation currently set on the SDL_Texture. Textures sharing the asset only call into SDL when their
+     * own modulation differs from it.
+     */
+    TextureModulation applied;
+  };
+
+  /**
+   * @brief Engine wide, reference counted cache of loaded textures keyed by file path. An image is decoded and
+   * uploaded the first time it is loaded, later loads of the same path share it for as long as any reference is held.
+   */
+  class TextureRegistry {
+    public:
+    /**
+     * @brief Returns the asset for the given file, loading it if no one currently holds a reference to it.
+     *
+     * @param filePath fully resolved path of the image
+     * @param useColorKey if true pixels matching Texture::COLOR_KEY are transparent
+     * @return nullptr if the image could not be loaded
+     */
+    static Ref<TextureAsset> Load(const std::string& filePath, bool useColorKey);
+    /**
+     * @brief Takes ownership of a texture that was not loaded from a file. Adopted textures are not cached.
+     */
+    static Ref<TextureAsset> Adopt(SDL_Texture* texture, int width, int height);
+    /**
+     * @brief Number of cached textures that are still referenced.
+     */
+    static size_t Size();
+    /**
+     * @brief Number of images decoded since start up.
+     */
+    static size_t Loads();
+    /**
+     * @brief Number of loads served from the cache since start up.
+     */
+    static size_t Hits();
+    /**
+     * @brief Removes entries whose texture has been released.
+     */
+    static void Prune();
+
+    private:
+    static Ref<TextureAsset> Manage(SDL_Texture* texture, int width, int height);
+    static void Release(TextureAsset* asset);
+    static std::string Key(const std::string& filePath, bool useColorKey);
+
+    static std::unordered_map<std::string, std::weak_ptr<TextureAsset>> _assets;
+    static size_t _loads;
+    static size_t _hits;
+  };
+
+}  // namespace CoffeeMaker
+
+#endif
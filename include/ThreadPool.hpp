@@ -0,0 +1,132 @@
+#ifndef _coffeemaker_threadpool_hpp
+#define _coffeemaker_threadpool_hpp
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CoffeeMaker {
+  namespace Async {
+
+    /**
+     * @brief Fixed set of worker threads that every engine background job runs on.
+     *
+     * Each worker owns a deque of jobs. A worker takes its newest job first and, once its own deque is empty, steals
+     * the oldest job of another worker. Jobs submitted from a worker go to the back of its own deque, jobs submitted
+     * from any other thread are handed out to the workers in turn. Workers sleep while there is nothing to run.
+     */
+    class ThreadPool {
+      public:
+      using Job = std::function<void(void)>;
+      template <typename F, typename... Args>
+      using Result = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+
+      /**
+       * @brief One worker per hardware thread, minus the main thread, and at least one.
+       */
+      static size_t DefaultNumWorkers();
+
+      explicit ThreadPool(size_t numWorkers = DefaultNumWorkers());
+      ThreadPool(const ThreadPool&) = delete;
+      ThreadPool& operator=(const ThreadPool&) = delete;
+      /**
+       * @brief Runs every job still queued, then joins the workers.
+       */
+      ~ThreadPool();
+
+      void Submit(Job job);
+
+      /**
+       * @brief Runs fn(args...) on the pool.
+       *
+       * @return std::future of whatever fn returns, exceptions thrown by fn are rethrown by get()
+       */
+      template <typename F, typename... Args>
+      std::future<Result<F, Args...>> Enqueue(F&& fn, Args&&... args) {
+        // NOTE: std::function must be copyable and std::packaged_task is not, so the task is shared instead
+        auto task = std::make_shared<std::packaged_task<Result<F, Args...>()>>(
+            [fn = std::forward<F>(fn), ... args = std::forward<Args>(args)]() mutable { return fn(args...); });
+        std::future<Result<F, Args...>> future = task->get_future();
+        Submit([task]() { (*task)(); });
+        return future;
+      }
+
+      /**
+       * @brief Calls body(first, last) over [begin, end) cut into chunks of at most grain indices, and returns once
+       * every chunk is done. The calling thread works through chunks as well, so it is safe to call from a job.
+       * The first exception thrown by body is rethrown once the other chunks have finished.
+       *
+       * @param begin
+       * @param end
+       * @param grain indices per chunk, 0 picks one that gives every worker a few chunks
+       * @param body
+       */
+      void ParallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+      /**
+       * @brief Blocks until the future is ready. On a worker, queued jobs are run while waiting instead, so a job
+       * waiting on another job can never hold up the whole pool.
+       */
+      template <typename T>
+      void Wait(const std::future<T>& future) {
+        if (IsWorker()) {
+          while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!RunPendingJob()) {
+              std::this_thread::yield();
+            }
+          }
+        }
+        future.wait();
+      }
+
+      /**
+       * @brief Runs a single queued job on the calling thread.
+       *
+       * @return false if there was nothing to run
+       */
+      bool RunPendingJob();
+
+      size_t NumWorkers() const;
+      /**
+       * @brief True on the worker threads of this pool.
+       */
+      bool IsWorker() const;
+
+      /**
+       * @brief The engine owned pool, started the first time it is used.
+       */
+      static ThreadPool* Instance();
+
+      private:
+      struct Worker {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+      };
+
+      void WorkerLoop(size_t index);
+      bool Pop(size_t index, Job& job);
+      bool Steal(size_t thief, Job& job);
+
+      std::vector<std::unique_ptr<Worker>> _workers;
+      std::vector<std::thread> _threads;
+      std::atomic<size_t> _nextWorker;
+      std::atomic<size_t> _pending;
+      std::mutex _sleepMutex;
+      std::condition_variable _wake;
+      bool _stopping;
+    };
+
+  }  // namespace Async
+}  // namespace CoffeeMaker
+
+#endif
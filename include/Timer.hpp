@@ -15,6 +15,10 @@
 
 namespace CoffeeMaker {
 
+  /**
+   * @brief Logs how long a scope took when it ends. For timings that are recorded every frame without logging, see
+   * CM_PROFILE_SCOPE in Profiler.hpp.
+   */
   class Performance {
     public:
     explicit Performance(const std::string& name) : _start(std::chrono::high_resolution_clock::now()), _name(name) {}
@@ -34,10 +38,24 @@ namespace CoffeeMaker {
     std::string _name;
   };
 
+  /**
+   * @brief Measures milliseconds on the clock set with SetClock, SDL_GetTicks by default. StopWatch and Timeout are
+   * Timers as well.
+   */
   class Timer {
     public:
+    using Clock = std::function<Uint32(void)>;
+
     Timer();
 
+    /**
+     * @brief Makes every Timer read its ticks from clock, ie: the simulated clock of a benchmark run so animations and
+     * timeouts run out on the same frame every time. Set it before any Timer is started, nullptr goes back to
+     * SDL_GetTicks.
+     */
+    static void SetClock(Clock clock);
+    static Uint32 Now();
+
     void Start();
     Uint32 GetTicks();
     void Pause();
@@ -59,6 +77,8 @@ namespace CoffeeMaker {
 
     bool _paused;
     bool _started;
+
+    static Clock _clock;
   };
 
   class StopWatch {
@@ -121,18 +141,16 @@ namespace CoffeeMaker {
 
   class Timeout : public CoffeeMaker::Timer {
     public:
-    explicit Timeout(Uint32 delay, std::function<void(void)> fn) : _delay(delay), _callback(fn), _started(false) {
+    explicit Timeout(Uint32 delay, std::function<void(void)> fn) :
+        _delay(delay), _callback(fn), _started(false), _index(_timeouts.size()) {
       _timeouts.emplace_back(this);
     };
     ~Timeout() {
-      for (auto it = _timeouts.begin(); it != _timeouts.end();) {
-        if (this == *it) {
-          it = _timeouts.erase(it);
-          break;
-        } else {
-          ++it;
-        }
-      }
+      // NOTE: the last timeout takes over this slot, timeouts are checked in no particular order
+      Timeout* last = _timeouts.back();
+      _timeouts[_index] = last;
+      last->_index = _index;
+      _timeouts.pop_back();
     };
 
     void Start() {
@@ -151,9 +169,10 @@ namespace CoffeeMaker {
     };
 
     static void ProcessTimeouts() {
-      for (auto& timeout : _timeouts) {
-        if (timeout->Check()) {
-          timeout->Act();
+      // NOTE: by index, a callback may destroy timeouts, the one moved into a freed slot is checked next frame
+      for (size_t i = 0; i < _timeouts.size(); i++) {
+        if (_timeouts[i]->Check()) {
+          _timeouts[i]->Act();
         }
       }
     }
@@ -174,6 +193,8 @@ namespace CoffeeMaker {
     Uint32 _delay;
     std::function<void(void)> _callback;
     bool _started;
+    // NOTE: slot in _timeouts, so a timeout leaves it without searching for itself
+    size_t _index;
 
     static std::vector<Timeout*> _timeouts;
   };
@@ -0,0 +1,124 @@
+#ifndef _coffeemaker_timerwheel_hpp
+#define _coffeemaker_timerwheel_hpp
+
+#include <SDL2/SDL.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace CoffeeMaker {
+  namespace Async {
+    class TimerWheel;
+
+    /**
+     * @brief Intrusive list node for a single timeout or interval scheduled on a TimerWheel.
+     * The owner keeps the node alive for as long as it is scheduled, destroying the node cancels it.
+     */
+    class TimerNode {
+      public:
+      TimerNode() = default;
+      explicit TimerNode(std::function<void(void)> callback) : _callback(callback) {}
+      TimerNode(const TimerNode&) = delete;
+      TimerNode& operator=(const TimerNode&) = delete;
+      ~TimerNode();
+
+      bool IsScheduled() const { return _wheel != nullptr; }
+
+      friend class TimerWheel;
+
+      private:
+      void Link(TimerNode* head);
+      void Unlink();
+
+      TimerNode* _prev{nullptr};
+      TimerNode* _next{nullptr};
+      TimerWheel* _wheel{nullptr};
+      std::uint64_t _expires{0};
+      Uint32 _period{0};
+      std::function<void(void)> _callback;
+    };
+
+    /**
+     * @brief Hierarchical timer wheel that runs every engine timeout and interval.
+     *
+     * Ticks are 1ms. Each level holds 64 slots, a timer is placed in the lowest level that can hold its
+     * remaining delay and is cascaded down into finer levels as the wheel turns. Scheduling and canceling
+     * are O(1). Callbacks run on whichever thread advances the wheel, for the engine wheel that is the
+     * main thread.
+     */
+    class TimerWheel {
+      public:
+      static constexpr unsigned int SLOT_BITS = 6;
+      static constexpr unsigned int NUM_SLOTS = 1 << SLOT_BITS;
+      static constexpr unsigned int SLOT_MASK = NUM_SLOTS - 1;
+      static constexpr unsigned int NUM_LEVELS = 4;
+      /**
+       * @brief Longest delay, in ms, that can be placed on the wheel without being re-cascaded.
+       */
+      static constexpr std::uint64_t MAX_DELAY = (static_cast<std::uint64_t>(1) << (SLOT_BITS * NUM_LEVELS)) - 1;
+
+      TimerWheel();
+      ~TimerWheel();
+
+      /**
+       * @brief Schedules the node to fire after the given delay. A non-zero period re-arms the node
+       * every period milliseconds after it first fires. Rescheduling a node that is already scheduled
+       * moves it.
+       *
+       * @param node
+       * @param delay delay in milliseconds
+       * @param period interval in milliseconds, 0 for a one shot timeout
+       */
+      void Schedule(TimerNode* node, Uint32 delay, Uint32 period = 0);
+      void Cancel(TimerNode* node);
+      /**
+       * @brief Milliseconds left until the node fires, 0 if the node is not scheduled.
+       */
+      Uint32 Remaining(const TimerNode* node) const;
+
+      /**
+       * @brief Turns the wheel by the given number of milliseconds, firing every timer that expires.
+       */
+      void Advance(Uint32 milliseconds);
+      /**
+       * @brief Advances the wheel by the time elapsed since the last Update. Elapsed time is discarded while
+       * the wheel is paused.
+       *
+       * @param currentTicks current clock time in milliseconds, ie: SDL_GetTicks()
+       */
+      void Update(Uint32 currentTicks);
+      void Pause();
+      void Unpause();
+      bool IsPaused() const;
+
+      std::uint64_t CurrentTick() const;
+      size_t NumScheduled() const;
+
+      /**
+       * @brief The engine owned wheel, serviced once per frame by the main loop.
+       */
+      static TimerWheel* Instance();
+      static void ProcessTimers();
+      static void PauseAllTimers();
+      static void UnpauseAllTimers();
+
+      private:
+      void Insert(TimerNode* node);
+      void Cascade(unsigned int level, unsigned int index);
+      void Tick();
+      static void Splice(TimerNode* from, TimerNode* to);
+
+      std::array<TimerNode, NUM_SLOTS * NUM_LEVELS> _slots;
+      TimerNode _expired;
+      std::uint64_t _currentTick;
+      Uint32 _lastTicks;
+      bool _started;
+      bool _paused;
+      size_t _numScheduled;
+    };
+  }  // namespace Async
+}  // namespace CoffeeMaker
+
+#endif
@@ -47,7 +47,10 @@ namespace CoffeeMaker {
         SDL_FreeSurface(loaded);
       }
 
-      void Render() { SDL_RenderCopy(renderer, _texture, NULL, &clientRect); }
+      void Render() {
+        CoffeeMaker::Renderer::Flush();
+        SDL_RenderCopy(renderer, _texture, NULL, &clientRect);
+      }
 
       std::string filePath;
       SDL_Rect clientRect;
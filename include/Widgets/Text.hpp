@@ -5,14 +5,20 @@
 #include <SDL2/SDL_ttf.h>
 
 #include <string>
+#include <vector>
 
 #include "Color.hpp"
 #include "FontManager.hpp"
+#include "GlyphAtlas.hpp"
 #include "Renderer.hpp"
 #include "Widgets/UIComponent.hpp"
 
 namespace CoffeeMaker {
   namespace Widgets {
+    /**
+     * @brief A string drawn from the glyphs of its font in the GlyphAtlas. Setting the text lays it out again without
+     * rasterizing anything, setting the color only changes the tint of its quads.
+     */
     class Text : public UIComponent {
       public:
       Text();
@@ -35,13 +41,12 @@ namespace CoffeeMaker {
       SDL_Color color;
 
       private:
-      void SetTextContentTexture();
+      void LayoutGlyphs();
 
       std::string _componentId;
       std::string _textContent;
       TTF_Font *_font;
-      SDL_Renderer *renderer;
-      SDL_Texture *_texture;
+      std::vector<CoffeeMaker::PlacedGlyph> _glyphs;
       Uint32 _wrapLength;
 
       static int _textId;
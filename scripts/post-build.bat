@@ -1 +1,2 @@
-robocopy assets build/Debug/assets /E
\ No newline at end of file
+robocopy assets build/Debug/assets /E
+robocopy build/baked/splines build/Debug/assets/splines *.bspline
\ No newline at end of file
@@ -1,9 +1,17 @@
 #!/bin/sh
 
 Directory="build/assets"
+BakedSplines="build/baked/splines"
 
 if [ -d "$Directory" ]; then
   rm -rf "$Directory" && cp -r assets "$Directory"
 else
   cp -r assets "$Directory"
 fi
+
+# NOTE: the .bspline files are baked by the build, put them back next to the .spline files they were baked from
+if [ -d "$BakedSplines" ]; then
+  cp "$BakedSplines"/*.bspline "$Directory/splines/"
+else
+  echo "No baked splines in $BakedSplines, build the project to bake them"
+fi
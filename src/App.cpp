@@ -15,25 +15,36 @@
 #include <argparse/argparse.hpp>
 #include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 
 #include "Audio.hpp"
+#include "Benchmark.hpp"
 #include "Color.hpp"
 #include "Cursor.hpp"
 #include "Event.hpp"
+#include "EventBus.hpp"
+#include "Executor.hpp"
 #include "FPS.hpp"
+#include "FixedTimestep.hpp"
 #include "FontManager.hpp"
+#include "FrameArena.hpp"
 #include "Game/Animations/SpriteAnimation.hpp"
 #include "Game/Collider.hpp"
 #include "Game/Events.hpp"
 #include "Game/Scene.hpp"
 #include "Game/Scenes/All.hpp"
 #include "Game/ScoreManager.hpp"
+#include "GlyphAtlas.hpp"
 #include "InputManager.hpp"
 #include "Logger.hpp"
 #include "Math.hpp"
+#include "Memory.hpp"
+#include "Profiler.hpp"
 #include "Renderer.hpp"
+#include "TextureAtlas.hpp"
 #include "Timer.hpp"
+#include "TimerWheel.hpp"
 #include "Utilities.hpp"
 #include "Widgets/Button.hpp"
 #include "Widgets/Text.hpp"
@@ -43,6 +54,24 @@ bool paused = false;
 bool quit = false;
 SDL_Event event;
 
+/**
+ * @brief Scene index for a --benchmark scene name, in the order the scenes are added in main.
+ *
+ * @return int -1 if there is no such scene
+ */
+int BenchmarkSceneIndex(const std::string& scene) {
+  if (scene == "title") {
+    return 0;
+  }
+  if (scene == "main") {
+    return 1;
+  }
+  if (scene == "highscores") {
+    return 2;
+  }
+  return -1;
+}
+
 // SDL_AssertState appHandler(const SDL_AssertData* data, void*) {
 //   std::cout << "Error executing function: " << data->function << std::endl;
 //   return SDL_ASSERTION_IGNORE;
@@ -66,6 +95,40 @@ int main(int argc, char** argv) {
       .help("sets the display height")
       .scan<'i', int>()
       .nargs(1);
+  program.add_argument("-tr", "--tick-rate")
+      .default_value(120)
+      .help("sets the simulation tick rate in Hz")
+      .scan<'i', int>()
+      .nargs(1);
+  program.add_argument("-b", "--benchmark")
+      .help("runs a scene (title, main or highscores) headless and reports frame times as JSON")
+      .nargs(1);
+  program.add_argument("-n", "--frames")
+      .default_value(1000)
+      .help("sets the number of frames recorded by --benchmark")
+      .scan<'i', int>()
+      .nargs(1);
+  program.add_argument("-o", "--benchmark-output")
+      .default_value(std::string(""))
+      .help("writes the --benchmark report to a file instead of stdout")
+      .nargs(1);
+#ifndef COFFEEMAKER_RELEASE_BUILD
+  program.add_argument("--log-allocations")
+      .default_value(false)
+      .help("logs every frame that allocates on the heap")
+      .implicit_value(true);
+#endif
+#ifdef COFFEEMAKER_PROFILING
+  program.add_argument("--profile-trace")
+      .default_value(std::string(""))
+      .help("writes every profiled zone to a Chrome trace file on exit")
+      .nargs(1);
+  program.add_argument("--profile-spike-ms")
+      .default_value(0)
+      .help("logs the profiled zones of any frame that takes longer than this")
+      .scan<'i', int>()
+      .nargs(1);
+#endif
   program.add_argument("-p", "--high-dpi")
       .default_value(false)
       .help("sets the window to High DPI mode")
@@ -79,7 +142,43 @@ int main(int argc, char** argv) {
     return 1;
   }
 
-  CoffeeMaker::Math::RandomEngine::Init();
+  // NOTE: the fixed step is 1 / tick rate, see FixedTimestep
+  if (program.get<int>("--tick-rate") <= 0) {
+    std::cerr << "The tick rate must be greater than 0, got: " << program.get<int>("--tick-rate") << std::endl;
+    std::cerr << program;
+    return 1;
+  }
+
+  int sceneIndex = program.get<int>("--scene");
+  Scope<CoffeeMaker::Benchmark> benchmark = nullptr;
+  if (auto scene = program.present("--benchmark")) {
+    sceneIndex = BenchmarkSceneIndex(*scene);
+    if (sceneIndex == -1) {
+      std::cerr << "Unknown benchmark scene: " << *scene << std::endl;
+      return 1;
+    }
+    benchmark =
+        CreateScope<CoffeeMaker::Benchmark>(*scene, program.get<int>("--frames"), program.get<int>("--tick-rate"));
+    // NOTE: no display, GPU or sound card is needed, so the numbers are comparable across CI machines
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+  }
+
+  if (benchmark != nullptr) {
+    CoffeeMaker::Math::RandomEngine::engine.seed(CoffeeMaker::Benchmark::SEED);
+    // NOTE: timeouts and sprite animations follow the simulated clock as well, see the TimerWheel below
+    CoffeeMaker::Timer::SetClock([&benchmark]() { return benchmark->SimulatedTicks(); });
+  } else {
+    CoffeeMaker::Math::RandomEngine::Init();
+  }
+
+#ifdef COFFEEMAKER_PROFILING
+  CoffeeMaker::Profiler::SetSpikeThreshold(program.get<int>("--profile-spike-ms"));
+  if (!program.get<std::string>("--profile-trace").empty()) {
+    CoffeeMaker::Profiler::StartCapture();
+  }
+#endif
   // Start clock
   auto start = std::chrono::steady_clock::now();
   CM_LOGGER_INIT();
@@ -116,9 +215,17 @@ int main(int argc, char** argv) {
   }
 #endif
   bool highDpiMode = program.get<bool>("--high-dpi");
+  if (benchmark != nullptr) {
+    width = program.get<int>("--display-width");
+    height = program.get<int>("--display-height");
+    fullscreen = false;
+    highDpiMode = false;
+  }
 
   CoffeeMaker::BasicWindow win("Ultra Cosmo Invaders", width, height, fullscreen, highDpiMode);
-  CoffeeMaker::Renderer renderer;
+  CoffeeMaker::Renderer renderer(benchmark != nullptr ? static_cast<Uint32>(SDL_RENDERER_SOFTWARE)
+                                                        : CoffeeMaker::Renderer::DEFAULT_FLAGS);
+  CoffeeMaker::TextureAtlas::Build();
 
   std::string basePath = CoffeeMaker::Utilities::BaseDirectory();
   basePath += "/assets/images/Player-NoBkGrd.png";
@@ -129,7 +236,8 @@ int main(int argc, char** argv) {
   CoffeeMaker::FontManager::Init();
   CoffeeMaker::FontManager::LoadFont("Sarpanch/Sarpanch-Regular");
   CoffeeMaker::FontManager::LoadFont("Sarpanch/Sarpanch-Bold");
-  CoffeeMaker::Timer globalTimer;
+  CoffeeMaker::FixedTimestep simulation(program.get<int>("--tick-rate"));
+  simulation.MakeCurrent();
   CoffeeMaker::FPS fpsCounter;
 
   CM_LOGGER_INFO("Display count: {}", win.DisplayCount());
@@ -148,8 +256,8 @@ int main(int argc, char** argv) {
   SceneManager::AddScene(new SplineBuilder());
 #endif
 
-  CoffeeMaker::Logger::Debug("Loading scene at index...{}", program.get<int>("--scene"));
-  if (!SceneManager::LoadScene(program.get<int>("--scene"))) {
+  CoffeeMaker::Logger::Debug("Loading scene at index...{}", sceneIndex);
+  if (!SceneManager::LoadScene(sceneIndex)) {
     quit = true;
   } else {
     win.ShowWindow();
@@ -162,66 +270,168 @@ int main(int argc, char** argv) {
     CoffeeMaker::UserEventHandler::RegisterUserEvents(UCI::NumEventsToRegister());
   }
 
+  // NOTE: scene scripts wait on gameplay events as well, which no longer go through the SDL queue
+  CoffeeMaker::EventSubscription sceneEvents = CoffeeMaker::EventBus::Instance()->SubscribeAll(
+      [](const SDL_UserEvent& userEvent) { SceneManager::DispatchUserEvent(userEvent); });
+
+  auto lastFrame = std::chrono::steady_clock::now();
+#ifndef COFFEEMAKER_RELEASE_BUILD
+  bool logAllocations = program.get<bool>("--log-allocations");
+#endif
   while (!quit) {
+    CoffeeMaker::FrameArena::Frame()->Reset();
+    if (benchmark != nullptr) {
+      benchmark->BeginFrame();
+      benchmark->ScriptInput();
+    }
+
     // get input
-    while (SDL_PollEvent(&event)) {
-      if (event.type == SDL_QUIT) {
-        quit = true;
-        SceneManager::DestroyCurrentScene();
-        break;
-      }
+    {
+      CM_PROFILE_SCOPE("EventPoll");
+      while (SDL_PollEvent(&event)) {
+        if (event.type == SDL_QUIT) {
+          quit = true;
+          SceneManager::DestroyCurrentScene();
+          break;
+        }
 
-      if (event.type >= SDL_USEREVENT && event.type < SDL_LASTEVENT) {
-        CoffeeMaker::UserEventHandler::HandleUserEvent(event.user);
-        if (event.user.code == CoffeeMaker::ApplicationEvents::COFFEEMAKER_GAME_PAUSE) {
-          paused = true;
-          SceneManager::PauseScene();
-          CoffeeMaker::Timeout::PauseAllTimeouts();
+        if (event.type >= SDL_USEREVENT && event.type < SDL_LASTEVENT) {
+          CoffeeMaker::UserEventHandler::HandleUserEvent(event.user);
+          SceneManager::DispatchUserEvent(event.user);
+          if (event.user.code == CoffeeMaker::ApplicationEvents::COFFEEMAKER_GAME_PAUSE) {
+            paused = true;
+            SceneManager::PauseScene();
+            CoffeeMaker::Timeout::PauseAllTimeouts();
+            CoffeeMaker::Async::TimerWheel::PauseAllTimers();
+          }
+          if (event.user.code == CoffeeMaker::ApplicationEvents::COFFEEMAKER_GAME_UNPAUSE ||
+              event.user.code == CoffeeMaker::ApplicationEvents::COFFEEMAKER_SCENE_LOAD) {
+            paused = false;
+            SceneManager::UnpauseScene();
+            CoffeeMaker::Timeout::UnpauseAllTimeouts();
+            CoffeeMaker::Async::TimerWheel::UnpauseAllTimers();
+          }
         }
-        if (event.user.code == CoffeeMaker::ApplicationEvents::COFFEEMAKER_GAME_UNPAUSE ||
-            event.user.code == CoffeeMaker::ApplicationEvents::COFFEEMAKER_SCENE_LOAD) {
-          paused = false;
-          SceneManager::UnpauseScene();
-          CoffeeMaker::Timeout::UnpauseAllTimeouts();
+
+        CoffeeMaker::Button::PollEvents(&event);
+        CoffeeMaker::MouseEventHandler::HandleMouseEvents(event);
+        if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) {
+          CoffeeMaker::InputManager::HandleKeyBoardEvent(&event.key);
         }
       }
-
-      CoffeeMaker::Button::PollEvents(&event);
-      CoffeeMaker::MouseEventHandler::HandleMouseEvents(event);
-      if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) {
-        CoffeeMaker::InputManager::HandleKeyBoardEvent(&event.key);
+      // NOTE: listeners destroyed while handling this frame's events are forgotten once, not after every event
+      CoffeeMaker::UserEventHandler::ClearUserEvents();
+      CoffeeMaker::MouseEventHandler::ClearMouseEvents();
+      if (!quit) {
+        // NOTE: gameplay events published last frame, after the SDL queue so a pause this frame is already known
+        CoffeeMaker::EventBus::ProcessEvents();
       }
     }
 
     if (!quit) {
-      CoffeeMaker::Timeout::ProcessTimeouts();
-      Animations::SpriteAnimation::ProcessSpriteAnimations();
-
-      float timeStep = globalTimer.GetTicks() / 1000.0f;
+      {
+        CM_PROFILE_SCOPE("Timeouts");
+        CoffeeMaker::Timeout::ProcessTimeouts();
+        if (benchmark != nullptr) {
+          // NOTE: timers follow the simulated clock so enemy waves spawn on the same frame on every run
+          CoffeeMaker::Async::TimerWheel::Instance()->Update(benchmark->SimulatedTicks());
+        } else {
+          CoffeeMaker::Async::TimerWheel::ProcessTimers();
+        }
+      }
+      {
+        CM_PROFILE_SCOPE("Coroutines");
+        // NOTE: after the timers, so a Delay that ran out this frame resumes this frame
+        CoffeeMaker::Async::Executor::ProcessReady();
+      }
+      {
+        CM_PROFILE_SCOPE("SpriteAnimations");
+        Animations::SpriteAnimation::ProcessSpriteAnimations();
+      }
 
-      // physics step
-      Collider::PhysicsUpdate();
+      auto now = std::chrono::steady_clock::now();
+      std::chrono::duration<double> frameTime = now - lastFrame;
+      lastFrame = now;
+
+      // NOTE: the simulation runs at the fixed tick rate, zero or more steps per rendered frame
+      // NOTE: a benchmark runs exactly one step per frame, however long the frame took
+      int steps = benchmark != nullptr ? 1 : simulation.Accumulate(frameTime.count());
+      for (int step = 0; step < steps; step++) {
+        CM_PROFILE_SCOPE("Step");
+        simulation.Step();
+
+        // physics step
+        {
+          CM_PROFILE_SCOPE("Physics");
+          CoffeeMaker::BenchmarkStage stage(benchmark.get(), CoffeeMaker::Benchmark::Stage::Physics);
+          Collider::PhysicsUpdate();
+        }
 
-      // run logic
-      // fpsCounter.Update();
-      SceneManager::UpdateCurrentScene(!paused ? timeStep : 0.0f);
+        // run logic
+        // fpsCounter.Update();
+        {
+          CM_PROFILE_SCOPE("Update");
+          CoffeeMaker::BenchmarkStage stage(benchmark.get(), CoffeeMaker::Benchmark::Stage::Update);
+          SceneManager::UpdateCurrentScene(!paused ? simulation.DeltaTime() : 0.0f);
+        }
+        {
+          CM_PROFILE_SCOPE("CollisionDispatch");
+          CoffeeMaker::BenchmarkStage stage(benchmark.get(), CoffeeMaker::Benchmark::Stage::Physics);
+          Collider::ProcessCollisions();
+        }
 
-      // Reset Timer
-      globalTimer.Start();
+        // NOTE: a key press is seen by the first step of the frame only
+        CoffeeMaker::InputManager::ClearAllPresses();
+      }
 
-      // render
-      renderer.BeginRender();
+      // render, positions are blended by simulation.Alpha() between the last two steps
+      {
+        CM_PROFILE_SCOPE("Render");
+        CoffeeMaker::BenchmarkStage stage(benchmark.get(), CoffeeMaker::Benchmark::Stage::Render);
+        renderer.BeginRender();
 
-      SceneManager::RenderCurrentScene();
-      // fpsCounter.Render();
+        SceneManager::RenderCurrentScene();
+        // fpsCounter.Render();
 
-      renderer.EndRender();
+        renderer.EndRender();
+      }
       // NOTE: uncomment here to view draw calls
-      // CM_LOGGER_INFO("[Renderer][Draw Calls]: {}", CoffeeMaker::Renderer::DrawCalls());
+      // CM_LOGGER_INFO("[Renderer][Draw Calls]: {} [Vertices]: {}", CoffeeMaker::Renderer::DrawCalls(),
+      //                CoffeeMaker::Renderer::Vertices());
 
-      CoffeeMaker::InputManager::ClearAllPresses();
       CoffeeMaker::Button::ProcessEvents();
-      Collider::ProcessCollisions();
+
+      if (benchmark != nullptr) {
+        benchmark->EndFrame(CoffeeMaker::Renderer::DrawCalls());
+        if (!benchmark->Running()) {
+          quit = true;
+          SceneManager::DestroyCurrentScene();
+        }
+      }
+    }
+
+    CoffeeMaker::Memory::EndFrame();
+#ifndef COFFEEMAKER_RELEASE_BUILD
+    if (logAllocations && CoffeeMaker::Memory::LastFrameAllocations() > 0) {
+      CM_LOGGER_DEBUG("[Memory] {} heap allocations this frame", CoffeeMaker::Memory::LastFrameAllocations());
+    }
+#endif
+    CM_PROFILE_FRAME();
+  }
+
+#ifdef COFFEEMAKER_PROFILING
+  if (CoffeeMaker::Profiler::Capturing()) {
+    CoffeeMaker::Profiler::WriteChromeTrace(program.get<std::string>("--profile-trace"));
+  }
+#endif
+
+  if (benchmark != nullptr) {
+    std::string output = program.get<std::string>("--benchmark-output");
+    if (output.empty()) {
+      std::cout << benchmark->ToJson();
+    } else {
+      std::ofstream report(output);
+      report << benchmark->ToJson();
     }
   }
 
@@ -229,7 +439,9 @@ int main(int argc, char** argv) {
   CoffeeMaker::Audio::StopMusic();
   CoffeeMaker::Audio::Quit();
   SceneManager::DestroyAllScenes();
+  CoffeeMaker::GlyphAtlas::Destroy();
   CoffeeMaker::FontManager::Destroy();
+  CoffeeMaker::TextureAtlas::Destroy();
   renderer.Destroy();
   SDL_Quit();
 
@@ -0,0 +1,140 @@
+#include "BakedSpline.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+// NOTE: samples and control points are written and read as plain pairs of floats
+static_assert(sizeof(CoffeeMaker::Math::Point2D) == sizeof(float) * 2);
+
+namespace {
+  template <typename T>
+  void Append(std::string& bytes, const T* data, size_t count) {
+    bytes.append(reinterpret_cast<const char*>(data), sizeof(T) * count);
+  }
+
+  /**
+   * @brief Copies count values out of data, memcpy'd since nothing in the file is guaranteed to be aligned.
+   */
+  template <typename T>
+  bool Take(const char*& data, const char* end, T* out, size_t count) {
+    const size_t size = sizeof(T) * count;
+    if (static_cast<size_t>(end - data) < size) {
+      return false;
+    }
+    if (size > 0) {
+      std::memcpy(out, data, size);
+    }
+    data += size;
+    return true;
+  }
+}  // namespace
+
+CoffeeMaker::BakedSpline::BakedSpline(std::vector<CoffeeMaker::Math::Point2D> points, std::vector<float> lengths) :
+    _points(std::move(points)), _lengths(std::move(lengths)) {}
+
+std::vector<float> CoffeeMaker::BakedSpline::ArcLengths(const std::vector<CoffeeMaker::Math::Point2D>& points) {
+  std::vector<float> lengths(points.size(), 0.0f);
+  float length = 0.0f;
+  for (size_t i = 1; i < points.size(); i++) {
+    length += std::hypot(points[i].x - points[i - 1].x, points[i].y - points[i - 1].y);
+    lengths[i] = length;
+  }
+  return lengths;
+}
+
+CoffeeMaker::Math::Point2D CoffeeMaker::BakedSpline::Point2DAtDistance(
+    float fraction, const CoffeeMaker::Math::Point2D& startOffset, const CoffeeMaker::Math::Point2D& endOffset) const {
+  const float weight = std::clamp(fraction, 0.0f, 1.0f);
+  const float distance = weight * _lengths.back();
+  // NOTE: the first sample past the distance, the point lies between it and the sample before
+  auto next = std::upper_bound(_lengths.begin() + 1, _lengths.end() - 1, distance);
+  const size_t i = static_cast<size_t>(next - _lengths.begin());
+  const float span = _lengths[i] - _lengths[i - 1];
+  const float t = span > 0.0f ? (distance - _lengths[i - 1]) / span : 0.0f;
+  return CoffeeMaker::Math::Point2D{
+      .x = CoffeeMaker::Math::Lerp(_points[i - 1].x, _points[i].x, t) +
+           CoffeeMaker::Math::Lerp(startOffset.x, endOffset.x, weight),
+      .y = CoffeeMaker::Math::Lerp(_points[i - 1].y, _points[i].y, t) +
+           CoffeeMaker::Math::Lerp(startOffset.y, endOffset.y, weight)};
+}
+
+CoffeeMaker::Math::Point2D CoffeeMaker::BakedSpline::First() const { return _points.front(); }
+
+CoffeeMaker::Math::Point2D CoffeeMaker::BakedSpline::Last() const { return _points.back(); }
+
+float CoffeeMaker::BakedSpline::Length() const { return _lengths.empty() ? 0.0f : _lengths.back(); }
+
+bool CoffeeMaker::BakedSpline::Empty() const { return _points.size() < 2; }
+
+CoffeeMaker::BakedSpline CoffeeMaker::BakedSpline::Invert(float width) const {
+  // NOTE: B-Splines are affine invariant, mirroring the samples is the same as mirroring the control points
+  std::vector<CoffeeMaker::Math::Point2D> inverted = _points;
+  for (auto& point : inverted) {
+    point.x = width - point.x;
+  }
+  return BakedSpline(std::move(inverted), _lengths);
+}
+
+CoffeeMaker::BakedSpline CoffeeMaker::BakedSpline::Scale(float sx, float sy) const {
+  std::vector<CoffeeMaker::Math::Point2D> scaled = _points;
+  for (auto& point : scaled) {
+    point.x *= sx;
+    point.y *= sy;
+  }
+  if (std::abs(sx - sy) <= 1e-6f * std::max(std::abs(sx), std::abs(sy))) {
+    std::vector<float> lengths = _lengths;
+    for (float& length : lengths) {
+      length *= std::abs(sx);
+    }
+    return BakedSpline(std::move(scaled), std::move(lengths));
+  }
+  std::vector<float> lengths = ArcLengths(scaled);
+  return BakedSpline(std::move(scaled), std::move(lengths));
+}
+
+std::string CoffeeMaker::SplineAsset::Encode() const {
+  Header header{.magic = {MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]},
+                .version = VERSION,
+                .numControlPoints = static_cast<std::uint32_t>(controlPoints.size()),
+                .numKnots = static_cast<std::uint32_t>(knots.size()),
+                .numSamples = static_cast<std::uint32_t>(path.Points().size())};
+  std::string bytes;
+  bytes.reserve(sizeof(Header) + sizeof(float) * (controlPoints.size() * 2 + knots.size() + header.numSamples * 3));
+  Append(bytes, &header, 1);
+  Append(bytes, controlPoints.data(), controlPoints.size());
+  Append(bytes, knots.data(), knots.size());
+  Append(bytes, path.Points().data(), path.Points().size());
+  Append(bytes, path.Lengths().data(), path.Lengths().size());
+  return bytes;
+}
+
+bool CoffeeMaker::SplineAsset::Decode(const char* data, size_t size, SplineAsset& asset) {
+  const char* end = data + size;
+  Header header;
+  if (data == nullptr || !Take(data, end, &header, 1) || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header.version != VERSION || header.numSamples < 2) {
+    return false;
+  }
+  // NOTE: the counts are not trusted until the file is known to hold that much, a corrupt one must not allocate
+  const std::uint64_t payload =
+      static_cast<std::uint64_t>(header.numControlPoints) * sizeof(CoffeeMaker::Math::Point2D) +
+      static_cast<std::uint64_t>(header.numKnots) * sizeof(float) +
+      static_cast<std::uint64_t>(header.numSamples) * (sizeof(CoffeeMaker::Math::Point2D) + sizeof(float));
+  if (static_cast<std::uint64_t>(end - data) != payload) {
+    return false;
+  }
+  std::vector<CoffeeMaker::Math::Point2D> controlPoints(header.numControlPoints);
+  std::vector<float> knots(header.numKnots);
+  std::vector<CoffeeMaker::Math::Point2D> points(header.numSamples);
+  std::vector<float> lengths(header.numSamples);
+  if (!Take(data, end, controlPoints.data(), controlPoints.size()) || !Take(data, end, knots.data(), knots.size()) ||
+      !Take(data, end, points.data(), points.size()) || !Take(data, end, lengths.data(), lengths.size())) {
+    return false;
+  }
+  asset.controlPoints = std::move(controlPoints);
+  asset.knots = std::move(knots);
+  asset.path = BakedSpline(std::move(points), std::move(lengths));
+  return true;
+}
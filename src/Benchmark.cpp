@@ -0,0 +1,169 @@
+#include "Benchmark.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "EventBus.hpp"
+#include "Executor.hpp"
+#include "FrameArena.hpp"
+#include "InputManager.hpp"
+#include "Memory.hpp"
+#include "Renderer.hpp"
+
+using namespace CoffeeMaker;
+
+namespace {
+  template <typename T>
+  std::string QueueToJson(const Async::MPSCQueue<T>& queue) {
+    return fmt::format(fmt::runtime(R"({{"capacity": {}, "highWater": {}, "overflows": {}}})"), queue.Capacity(),
+                       queue.HighWater(), queue.Overflows());
+  }
+
+  std::string StatsToJson(const BenchmarkStats& stats) {
+    return fmt::format(
+        fmt::runtime(R"({{"mean": {:.4f}, "p50": {:.4f}, "p95": {:.4f}, "p99": {:.4f}, "max": {:.4f}}})"), stats.mean,
+        stats.p50, stats.p95, stats.p99, stats.max);
+  }
+}  // namespace
+
+Benchmark::Benchmark(const std::string& scene, int frames, double tickRate) :
+    _scene(scene),
+    _frames(std::max(frames, 1)),
+    _tickRate(tickRate),
+    _stageTime{},
+    _frameAllocations(0) {
+  // NOTE: reserved up front so recording does not show up in the allocation counts
+  _frameTimes.reserve(_frames);
+  for (auto& times : _stageTimes) {
+    times.reserve(_frames);
+  }
+  _drawCalls.reserve(_frames);
+  _allocations.reserve(_frames);
+}
+
+bool Benchmark::Running() const { return Frame() < _frames; }
+
+int Benchmark::Frame() const { return static_cast<int>(_frameTimes.size()); }
+
+Uint32 Benchmark::SimulatedTicks() const { return static_cast<Uint32>(std::lround(Frame() * 1000.0 / _tickRate)); }
+
+void Benchmark::BeginFrame() {
+  _stageTime.fill(0.0);
+  _frameAllocations = Memory::Allocations();
+  _frameStart = Clock::now();
+}
+
+void Benchmark::EndFrame(Uint32 drawCalls) {
+  _frameTimes.push_back(Milliseconds(_frameStart, Clock::now()));
+  for (size_t i = 0; i < NUM_STAGES; i++) {
+    _stageTimes[i].push_back(_stageTime[i]);
+  }
+  _drawCalls.push_back(static_cast<double>(drawCalls));
+  _allocations.push_back(static_cast<double>(Memory::Allocations() - _frameAllocations));
+}
+
+void Benchmark::BeginStage(Stage stage) { _stageStart[static_cast<size_t>(stage)] = Clock::now(); }
+
+void Benchmark::EndStage(Stage stage) {
+  size_t index = static_cast<size_t>(stage);
+  _stageTime[index] += Milliseconds(_stageStart[index], Clock::now());
+}
+
+const std::vector<double>& Benchmark::StageTimes(Stage stage) const { return _stageTimes[static_cast<size_t>(stage)]; }
+
+void Benchmark::ScriptInput() const {
+  const int frame = Frame();
+  const int sweep = frame % (2 * SWEEP_FRAMES);
+  if (sweep == 0) {
+    Key(SDL_SCANCODE_LEFT, false);
+    Key(SDL_SCANCODE_RIGHT, true);
+  } else if (sweep == SWEEP_FRAMES) {
+    Key(SDL_SCANCODE_RIGHT, false);
+    Key(SDL_SCANCODE_LEFT, true);
+  }
+
+  // NOTE: released on the following frame, a press and release in the same frame would cancel out
+  if (frame % FIRE_FRAMES == 0) {
+    Key(SDL_SCANCODE_SPACE, true);
+  } else if (frame % FIRE_FRAMES == 1) {
+    Key(SDL_SCANCODE_SPACE, false);
+  }
+}
+
+std::string Benchmark::ToJson() const {
+  const char* videoDriver = SDL_GetCurrentVideoDriver();
+  SDL_RendererInfo info{};
+  if (!Renderer::Exists() || SDL_GetRendererInfo(Renderer::Instance(), &info) != 0) {
+    info.name = nullptr;
+  }
+  double totalAllocations = std::accumulate(_allocations.begin(), _allocations.end(), 0.0);
+
+  std::string json = "{\n";
+  json += fmt::format(fmt::runtime("  \"scene\": \"{}\",\n"), _scene);
+  json += fmt::format(fmt::runtime("  \"frames\": {},\n"), Frame());
+  json += fmt::format(fmt::runtime("  \"tickRate\": {},\n"), _tickRate);
+  json += fmt::format(fmt::runtime("  \"videoDriver\": \"{}\",\n"), videoDriver != nullptr ? videoDriver : "");
+  json += fmt::format(fmt::runtime("  \"renderer\": \"{}\",\n"), info.name != nullptr ? info.name : "");
+  json += fmt::format(fmt::runtime("  \"frameMs\": {},\n"), StatsToJson(Summarize(_frameTimes)));
+  json += fmt::format(fmt::runtime("  \"updateMs\": {},\n"),
+                      StatsToJson(Summarize(_stageTimes[static_cast<size_t>(Stage::Update)])));
+  json += fmt::format(fmt::runtime("  \"physicsMs\": {},\n"),
+                      StatsToJson(Summarize(_stageTimes[static_cast<size_t>(Stage::Physics)])));
+  json += fmt::format(fmt::runtime("  \"renderMs\": {},\n"),
+                      StatsToJson(Summarize(_stageTimes[static_cast<size_t>(Stage::Render)])));
+  json += fmt::format(fmt::runtime("  \"drawCalls\": {},\n"), StatsToJson(Summarize(_drawCalls)));
+  json += fmt::format(fmt::runtime("  \"allocations\": {{\"total\": {:.0f}, \"perFrame\": {}}},\n"), totalAllocations,
+                      StatsToJson(Summarize(_allocations)));
+  json += fmt::format(fmt::runtime("  \"frameArena\": {{\"capacity\": {}, \"highWater\": {}, \"overflows\": {}}},\n"),
+                      FrameArena::Frame()->Capacity(), FrameArena::Frame()->HighWater(),
+                      FrameArena::Frame()->Overflows());
+  json += fmt::format(fmt::runtime("  \"eventQueue\": {},\n"), QueueToJson(EventBus::Instance()->Queue()));
+  json += fmt::format(fmt::runtime("  \"executorQueue\": {}\n"), QueueToJson(Async::Executor::Instance()->Queue()));
+  json += "}\n";
+  return json;
+}
+
+double Benchmark::Percentile(const std::vector<double>& sorted, double percentile) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+  return sorted[std::clamp(rank, static_cast<size_t>(1), sorted.size()) - 1];
+}
+
+BenchmarkStats Benchmark::Summarize(std::vector<double> samples) {
+  std::sort(samples.begin(), samples.end());
+  double mean = samples.empty() ? 0.0 : std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+  return BenchmarkStats{.mean = mean,
+                        .p50 = Percentile(samples, 50.0),
+                        .p95 = Percentile(samples, 95.0),
+                        .p99 = Percentile(samples, 99.0),
+                        .max = samples.empty() ? 0.0 : samples.back()};
+}
+
+void Benchmark::Key(SDL_Scancode scanCode, bool down) {
+  SDL_KeyboardEvent event{};
+  event.type = down ? SDL_KEYDOWN : SDL_KEYUP;
+  event.state = down ? SDL_PRESSED : SDL_RELEASED;
+  event.keysym.scancode = scanCode;
+  InputManager::HandleKeyBoardEvent(&event);
+}
+
+double Benchmark::Milliseconds(Clock::time_point start, Clock::time_point end) {
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+BenchmarkStage::BenchmarkStage(Benchmark* benchmark, Benchmark::Stage stage) : _benchmark(benchmark), _stage(stage) {
+  if (_benchmark != nullptr) {
+    _benchmark->BeginStage(_stage);
+  }
+}
+
+BenchmarkStage::~BenchmarkStage() {
+  if (_benchmark != nullptr) {
+    _benchmark->EndStage(_stage);
+  }
+}
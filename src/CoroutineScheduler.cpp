@@ -0,0 +1,187 @@
+#include "CoroutineScheduler.hpp"
+
+#include <algorithm>
+
+using namespace CoffeeMaker;
+
+CoroutineScheduler* CoroutineScheduler::_current = nullptr;
+
+CoroutineScheduler::CoroutineScheduler() :
+    _frameWaits(),
+    _timedWaits(),
+    _conditionWaits(),
+    _eventWaits(),
+    _asyncWaits(),
+    _ready(),
+    _readyIndex(0),
+    _resuming(false),
+    _time(0.0),
+    _order(0),
+    _paused(false) {}
+
+CoroutineScheduler::~CoroutineScheduler() {
+  Clear();
+  if (_current == this) {
+    _current = nullptr;
+  }
+}
+
+void CoroutineScheduler::WaitFrame(ScriptHandle handle) { _frameWaits.push_back(handle); }
+
+void CoroutineScheduler::WaitTime(double time, ScriptHandle handle) {
+  _timedWaits.push_back(TimedWait{.time = time, .order = _order++, .handle = handle});
+  std::push_heap(_timedWaits.begin(), _timedWaits.end(), Later);
+}
+
+void CoroutineScheduler::WaitCondition(std::function<bool(void)> condition, ScriptHandle handle) {
+  _conditionWaits.push_back(ConditionWait{.condition = std::move(condition), .handle = handle});
+}
+
+void CoroutineScheduler::WaitEvent(Uint32 type, void* target, SDL_UserEvent* received, ScriptHandle handle) {
+  _eventWaits.push_back(EventWait{.type = type, .target = target, .received = received, .handle = handle});
+}
+
+void CoroutineScheduler::WaitAsync(const std::shared_ptr<AsyncWait>& wait) { _asyncWaits.push_back(wait); }
+
+void CoroutineScheduler::Update(float deltaTime) {
+  if (_paused) {
+    return;
+  }
+  _time += deltaTime;
+
+  // NOTE: collected before anything resumes, a script that waits again from here is left for the next Update
+  _ready.insert(_ready.end(), _frameWaits.begin(), _frameWaits.end());
+  _frameWaits.clear();
+  while (!_timedWaits.empty() && _timedWaits.front().time <= _time) {
+    std::pop_heap(_timedWaits.begin(), _timedWaits.end(), Later);
+    _ready.push_back(_timedWaits.back().handle);
+    _timedWaits.pop_back();
+  }
+  auto met = std::stable_partition(_conditionWaits.begin(), _conditionWaits.end(),
+                                   [](const ConditionWait& wait) { return !wait.condition(); });
+  for (auto wait = met; wait != _conditionWaits.end(); wait++) {
+    _ready.push_back(wait->handle);
+  }
+  _conditionWaits.erase(met, _conditionWaits.end());
+
+  ResumeReady();
+}
+
+void CoroutineScheduler::Dispatch(const SDL_UserEvent& event) {
+  auto matched = std::stable_partition(_eventWaits.begin(), _eventWaits.end(), [&event](const EventWait& wait) {
+    return wait.type != event.type || (wait.target != nullptr && wait.target != event.data1);
+  });
+  for (auto wait = matched; wait != _eventWaits.end(); wait++) {
+    *wait->received = event;
+    _ready.push_back(wait->handle);
+  }
+  _eventWaits.erase(matched, _eventWaits.end());
+
+  ResumeReady();
+}
+
+void CoroutineScheduler::Pause() { _paused = true; }
+
+void CoroutineScheduler::Unpause() { _paused = false; }
+
+bool CoroutineScheduler::IsPaused() const { return _paused; }
+
+double CoroutineScheduler::Time() const { return _time; }
+
+size_t CoroutineScheduler::NumWaiting() const {
+  return _frameWaits.size() + _timedWaits.size() + _conditionWaits.size() + _eventWaits.size() + _asyncWaits.size();
+}
+
+void CoroutineScheduler::Clear() {
+  // NOTE: destroying a frame can end a script that clears again, so every list is emptied before any is destroyed
+  std::vector<ScriptHandle> handles;
+  handles.swap(_frameWaits);
+  for (const TimedWait& wait : _timedWaits) {
+    handles.push_back(wait.handle);
+  }
+  for (const ConditionWait& wait : _conditionWaits) {
+    handles.push_back(wait.handle);
+  }
+  for (const EventWait& wait : _eventWaits) {
+    handles.push_back(wait.handle);
+  }
+  for (const std::shared_ptr<AsyncWait>& wait : _asyncWaits) {
+    // NOTE: whatever still holds the wait finds it canceled when it tries to resume the script
+    wait->_canceled = true;
+    wait->_scheduler = nullptr;
+    handles.push_back(wait->_handle);
+  }
+  if (_resuming) {
+    // NOTE: the script at _readyIndex is the one running right now, only the ones after it never got to run
+    handles.insert(handles.end(), _ready.begin() + static_cast<std::ptrdiff_t>(_readyIndex) + 1, _ready.end());
+    _ready.resize(_readyIndex + 1);
+  }
+  _timedWaits.clear();
+  _conditionWaits.clear();
+  _eventWaits.clear();
+  _asyncWaits.clear();
+  _time = 0.0;
+  _order = 0;
+
+  for (const ScriptHandle& handle : handles) {
+    handle.Destroy();
+  }
+}
+
+void CoroutineScheduler::MakeCurrent() { _current = this; }
+
+CoroutineScheduler* CoroutineScheduler::Current() { return _current; }
+
+bool CoroutineScheduler::Later(const TimedWait& a, const TimedWait& b) {
+  // NOTE: scripts due at the same time resume in the order they started waiting
+  return a.time != b.time ? a.time > b.time : a.order > b.order;
+}
+
+void CoroutineScheduler::Forget(const AsyncWait* wait) {
+  auto found = std::find_if(_asyncWaits.begin(), _asyncWaits.end(),
+                            [wait](const std::shared_ptr<AsyncWait>& tracked) { return tracked.get() == wait; });
+  if (found != _asyncWaits.end()) {
+    _asyncWaits.erase(found);
+  }
+}
+
+void CoroutineScheduler::ResumeReady() {
+  if (_resuming) {
+    // NOTE: the outer call picks up whatever was just made ready
+    return;
+  }
+  _resuming = true;
+  for (_readyIndex = 0; _readyIndex < _ready.size(); _readyIndex++) {
+    ScriptHandle handle = _ready[_readyIndex];
+    handle.Resume();
+  }
+  _ready.clear();
+  _readyIndex = 0;
+  _resuming = false;
+}
+
+std::shared_ptr<AsyncWait> AsyncWait::Start(CoroutineScheduler* scheduler, ScriptHandle handle) {
+  std::shared_ptr<AsyncWait> wait = std::make_shared<AsyncWait>(scheduler, handle);
+  if (scheduler != nullptr) {
+    scheduler->WaitAsync(wait);
+  }
+  return wait;
+}
+
+AsyncWait::AsyncWait(CoroutineScheduler* scheduler, ScriptHandle handle) :
+    _scheduler(scheduler), _handle(handle), _canceled(false), _resumed(false) {}
+
+bool AsyncWait::Resume() {
+  if (_canceled || _resumed) {
+    return false;
+  }
+  _resumed = true;
+  if (_scheduler != nullptr) {
+    _scheduler->Forget(this);
+    _scheduler = nullptr;
+  }
+  _handle.Resume();
+  return true;
+}
+
+bool AsyncWait::IsCanceled() const { return _canceled; }
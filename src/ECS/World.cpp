@@ -0,0 +1,90 @@
+#include "ECS/World.hpp"
+
+using namespace CoffeeMaker::ECS;
+
+World* World::_current = nullptr;
+
+World::World() : _generations(), _free(), _pools(), _pending(), _alive(0), _iterating(0) {}
+
+World::~World() {
+  if (_current == this) {
+    _current = nullptr;
+  }
+}
+
+Handle World::Create() {
+  Handle handle;
+  if (!_free.empty()) {
+    handle.index = _free.back();
+    _free.pop_back();
+  } else {
+    handle.index = static_cast<std::uint32_t>(_generations.size());
+    _generations.push_back(0);
+  }
+  handle.generation = _generations[handle.index];
+  _alive++;
+  return handle;
+}
+
+void World::Destroy(Handle handle) {
+  if (!IsAlive(handle)) {
+    return;
+  }
+  if (_iterating > 0) {
+    _pending.push_back(handle);
+    return;
+  }
+  for (auto& pool : _pools) {
+    if (pool != nullptr) {
+      pool->Remove(handle);
+    }
+  }
+  // NOTE: the index goes back on the free list under a generation no handle has been given yet
+  _generations[handle.index]++;
+  _free.push_back(handle.index);
+  _alive--;
+}
+
+bool World::IsAlive(Handle handle) const {
+  return handle.index < _generations.size() && _generations[handle.index] == handle.generation;
+}
+
+size_t World::NumAlive() const { return _alive; }
+
+void World::Clear() {
+  for (auto& pool : _pools) {
+    if (pool != nullptr) {
+      pool->Clear();
+    }
+  }
+  _free.clear();
+  for (std::uint32_t index = 0; index < _generations.size(); index++) {
+    _generations[index]++;
+    _free.push_back(index);
+  }
+  _pending.clear();
+  _alive = 0;
+}
+
+void World::MakeCurrent() { _current = this; }
+
+World* World::Current() {
+  if (_current == nullptr) {
+    static World world;
+    _current = &world;
+  }
+  return _current;
+}
+
+size_t World::NextComponentId() {
+  static size_t next = 0;
+  return next++;
+}
+
+void World::DestroyPending() {
+  std::vector<Handle> pending;
+  pending.swap(_pending);
+  for (const Handle& handle : pending) {
+    Destroy(handle);
+  }
+}
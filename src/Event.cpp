@@ -68,7 +68,8 @@ Delegate::Delegate(std::function<void(const Event& event)> cb) {
 Delegate::~Delegate() { _function = nullptr; }
 
 void Event::Emit() {
-  auto e = [this](EventListener& listener) { std::invoke(listener.Get(), *this); };
+  // NOTE: invoked in place, copying the std::function out of each listener allocates on every emit
+  auto e = [this](EventListener& listener) { listener.Invoke(*this); };
   std::for_each(_listeners.begin(), _listeners.end(), e);
 }
 
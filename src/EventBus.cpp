@@ -0,0 +1,211 @@
+#include "EventBus.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Window.hpp"
+
+using namespace CoffeeMaker;
+
+EventSubscription::EventSubscription() : _bus(nullptr), _id(0) {}
+
+EventSubscription::EventSubscription(EventBus* bus, std::uint64_t id) : _bus(bus), _id(id) {}
+
+EventSubscription::EventSubscription(EventSubscription&& other) noexcept : _bus(other._bus), _id(other._id) {
+  other._bus = nullptr;
+  other._id = 0;
+}
+
+EventSubscription& EventSubscription::operator=(EventSubscription&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    _bus = std::exchange(other._bus, nullptr);
+    _id = std::exchange(other._id, 0);
+  }
+  return *this;
+}
+
+EventSubscription::~EventSubscription() { Reset(); }
+
+void EventSubscription::Reset() {
+  if (_bus != nullptr) {
+    _bus->Unsubscribe(_id);
+    _bus = nullptr;
+    _id = 0;
+  }
+}
+
+bool EventSubscription::IsActive() const { return _bus != nullptr; }
+
+EventBus::EventBus() :
+    _channels(),
+    _all(),
+    _locations(),
+    _queue(QUEUE_CAPACITY),
+    _front(),
+    _nextId(0),
+    _dispatching(false),
+    _stale(false) {}
+
+EventSubscription EventBus::Subscribe(Uint32 type, Handler handler) {
+  return Add(_channels[type].any, Location{.type = type, .target = nullptr, .all = false}, std::move(handler));
+}
+
+EventSubscription EventBus::Subscribe(Uint32 type, const void* target, Handler handler) {
+  return Add(_channels[type].routed[target], Location{.type = type, .target = target, .all = false},
+             std::move(handler));
+}
+
+EventSubscription EventBus::SubscribeAll(Handler handler) {
+  return Add(_all, Location{.type = 0, .target = nullptr, .all = true}, std::move(handler));
+}
+
+void EventBus::Publish(Uint32 type, Sint32 code, void* data1, void* data2) {
+  Publish(SDL_UserEvent{.type = type,
+                        .timestamp = SDL_GetTicks(),
+                        .windowID = CoffeeMaker::GlobalWindow::ID(),
+                        .code = code,
+                        .data1 = data1,
+                        .data2 = data2});
+}
+
+void EventBus::Publish(const SDL_UserEvent& event) { _queue.Push(event); }
+
+size_t EventBus::Dispatch() {
+  if (_dispatching) {
+    return 0;
+  }
+  // NOTE: copied out first, whatever the handlers publish stays queued for the next Dispatch
+  _queue.Drain([this](SDL_UserEvent&& event) { _front.push_back(event); });
+
+  _dispatching = true;
+  for (const SDL_UserEvent& event : _front) {
+    auto found = _channels.find(event.type);
+    if (found != _channels.end()) {
+      // NOTE: a reference, not the iterator, a handler subscribing to a new type can rehash _channels
+      Channel& channel = found->second;
+      Deliver(channel.any, event);
+      if (event.data1 != nullptr) {
+        auto routed = channel.routed.find(event.data1);
+        if (routed != channel.routed.end()) {
+          Deliver(routed->second, event);
+        }
+      }
+    }
+    Deliver(_all, event);
+  }
+  _dispatching = false;
+
+  const size_t delivered = _front.size();
+  // NOTE: cleared rather than released, the buffer settles at the busiest frame and stops allocating
+  _front.clear();
+  if (_stale) {
+    Compact();
+  }
+  return delivered;
+}
+
+size_t EventBus::NumQueued() const { return _queue.Size(); }
+
+const CoffeeMaker::Async::MPSCQueue<SDL_UserEvent>& EventBus::Queue() const { return _queue; }
+
+size_t EventBus::NumSubscribers(Uint32 type) const {
+  auto channel = _channels.find(type);
+  if (channel == _channels.end()) {
+    return 0;
+  }
+  size_t count = CountActive(channel->second.any);
+  for (const auto& [target, subscribers] : channel->second.routed) {
+    count += CountActive(subscribers);
+  }
+  return count;
+}
+
+size_t EventBus::NumSubscribers(Uint32 type, const void* target) const {
+  auto channel = _channels.find(type);
+  if (channel == _channels.end()) {
+    return 0;
+  }
+  auto routed = channel->second.routed.find(target);
+  return routed == channel->second.routed.end() ? 0 : CountActive(routed->second);
+}
+
+EventBus* EventBus::Instance() {
+  static EventBus bus;
+  return &bus;
+}
+
+size_t EventBus::ProcessEvents() { return Instance()->Dispatch(); }
+
+EventSubscription EventBus::Add(Subscribers& subscribers, Location location, Handler handler) {
+  const std::uint64_t id = ++_nextId;
+  subscribers.push_back(Subscriber{.id = id, .handler = std::move(handler), .removed = false});
+  _locations.emplace(id, location);
+  return EventSubscription(this, id);
+}
+
+void EventBus::Unsubscribe(std::uint64_t id) {
+  auto location = _locations.find(id);
+  if (location == _locations.end()) {
+    return;
+  }
+  const Location where = location->second;
+  _locations.erase(location);
+
+  Subscribers* subscribers = &_all;
+  Channel* channel = nullptr;
+  if (!where.all) {
+    channel = &_channels[where.type];
+    subscribers = where.target == nullptr ? &channel->any : &channel->routed[where.target];
+  }
+  auto subscriber = std::find_if(subscribers->begin(), subscribers->end(),
+                                 [id](const Subscriber& entry) { return entry.id == id; });
+  if (subscriber == subscribers->end()) {
+    return;
+  }
+
+  if (_dispatching) {
+    // NOTE: the handler may be the one running right now, it is only flagged and erased once dispatch is over
+    subscriber->removed = true;
+    _stale = true;
+    return;
+  }
+  subscribers->erase(subscriber);
+  if (where.target != nullptr && subscribers->empty()) {
+    // NOTE: targets are usually addresses of entities, which get reused once they are deleted
+    channel->routed.erase(where.target);
+  }
+}
+
+void EventBus::Compact() {
+  auto isRemoved = [](const Subscriber& subscriber) { return subscriber.removed; };
+  _all.erase(std::remove_if(_all.begin(), _all.end(), isRemoved), _all.end());
+  for (auto& [type, channel] : _channels) {
+    channel.any.erase(std::remove_if(channel.any.begin(), channel.any.end(), isRemoved), channel.any.end());
+    for (auto routed = channel.routed.begin(); routed != channel.routed.end();) {
+      routed->second.erase(std::remove_if(routed->second.begin(), routed->second.end(), isRemoved),
+                           routed->second.end());
+      routed = routed->second.empty() ? channel.routed.erase(routed) : std::next(routed);
+    }
+  }
+  _stale = false;
+}
+
+void EventBus::Deliver(const Subscribers& subscribers, const SDL_UserEvent& event) {
+  // NOTE: handlers subscribed during this event are left for the next one
+  const size_t count = subscribers.size();
+  for (size_t i = 0; i < count; i++) {
+    if (!subscribers[i].removed) {
+      subscribers[i].handler(event);
+    }
+  }
+}
+
+size_t EventBus::CountActive(const Subscribers& subscribers) {
+  return static_cast<size_t>(std::count_if(subscribers.begin(), subscribers.end(),
+                                           [](const Subscriber& subscriber) { return !subscriber.removed; }));
+}
+
+void CoffeeMaker::PublishEvent(Uint32 type, Sint32 eventCode, void* data1, void* data2) {
+  EventBus::Instance()->Publish(type, eventCode, data1, data2);
+}
@@ -0,0 +1,22 @@
+#include "Executor.hpp"
+
+using namespace CoffeeMaker::Async;
+
+Executor::Executor() : _ready(QUEUE_CAPACITY) {}
+
+void Executor::Post(Job job) { _ready.Push(std::move(job)); }
+
+size_t Executor::Drain() {
+  return _ready.Drain([](Job&& job) { job(); });
+}
+
+size_t Executor::NumReady() const { return _ready.Size(); }
+
+const MPSCQueue<Executor::Job>& Executor::Queue() const { return _ready; }
+
+Executor* Executor::Instance() {
+  static Executor executor;
+  return &executor;
+}
+
+size_t Executor::ProcessReady() { return Instance()->Drain(); }
@@ -0,0 +1,131 @@
+#include "File.hpp"
+
+#include <SDL2/SDL.h>
+
+#include <cstdlib>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+CoffeeMaker::File CoffeeMaker::ReadFile(const std::string& fileName) {
+  File result{.name = fileName, .loaded = false, .data = nullptr};
+  SDL_RWops* file = SDL_RWFromFile(fileName.c_str(), "r");
+  if (file == NULL) {
+    return result;
+  }
+  Sint64 resultSize = SDL_RWsize(file);
+  result.data = (char*)malloc(resultSize + 1);
+  char* buf = result.data;
+  Sint64 nb_read_total = 0;
+  Sint64 nb_read = 1;
+  while (nb_read_total < resultSize && nb_read != 0) {
+    nb_read = SDL_RWread(file, buf, 1, resultSize - nb_read_total);
+    nb_read_total += nb_read;
+    buf += nb_read;
+  }
+  SDL_RWclose(file);
+  if (nb_read_total != resultSize) {
+    free(result.data);
+    result.data = nullptr;
+    return result;
+  }
+  result.data[nb_read_total] = '\0';
+  result.loaded = true;
+  return result;
+}
+
+bool CoffeeMaker::WriteFile(const std::string& fileName, const std::string& data) {
+  SDL_RWops* file = SDL_RWFromFile(fileName.c_str(), "w");
+  if (file == NULL) {
+    return false;
+  }
+  const bool written = SDL_RWwrite(file, data.c_str(), 1, data.size()) == data.size();
+  SDL_RWclose(file);
+  return written;
+}
+
+#ifdef _WIN32
+CoffeeMaker::MappedFile::MappedFile() : _data(nullptr), _size(0), _file(INVALID_HANDLE_VALUE), _mapping(nullptr) {}
+#else
+CoffeeMaker::MappedFile::MappedFile() : _data(nullptr), _size(0) {}
+#endif
+
+CoffeeMaker::MappedFile::~MappedFile() { Close(); }
+
+bool CoffeeMaker::MappedFile::Open(const std::string& fileName) {
+  Close();
+#ifdef _WIN32
+  _file =
+      CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  LARGE_INTEGER size;
+  if (_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(_file, &size) || size.QuadPart == 0) {
+    Close();
+    return false;
+  }
+  _mapping = CreateFileMappingA(_file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (_mapping == nullptr) {
+    Close();
+    return false;
+  }
+  _data = static_cast<const char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+  if (_data == nullptr) {
+    Close();
+    return false;
+  }
+  _size = static_cast<size_t>(size.QuadPart);
+#else
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+    close(fd);
+    return false;
+  }
+  void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  // NOTE: the mapping holds on to the file, the descriptor is not needed past this point
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  _data = static_cast<const char*>(data);
+  _size = static_cast<size_t>(info.st_size);
+#endif
+  return true;
+}
+
+void CoffeeMaker::MappedFile::Close() {
+#ifdef _WIN32
+  if (_data != nullptr) {
+    UnmapViewOfFile(_data);
+  }
+  if (_mapping != nullptr) {
+    CloseHandle(_mapping);
+  }
+  if (_file != INVALID_HANDLE_VALUE) {
+    CloseHandle(_file);
+  }
+  _mapping = nullptr;
+  _file = INVALID_HANDLE_VALUE;
+#else
+  if (_data != nullptr) {
+    munmap(const_cast<char*>(_data), _size);
+  }
+#endif
+  _data = nullptr;
+  _size = 0;
+}
+
+bool CoffeeMaker::MappedFile::IsOpen() const { return _data != nullptr; }
+
+const char* CoffeeMaker::MappedFile::Data() const { return _data; }
+
+size_t CoffeeMaker::MappedFile::Size() const { return _size; }
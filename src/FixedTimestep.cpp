@@ -0,0 +1,80 @@
+#include "FixedTimestep.hpp"
+
+#include <algorithm>
+
+using namespace CoffeeMaker;
+
+FixedTimestep* FixedTimestep::_current = nullptr;
+
+FixedTimestep::FixedTimestep(double tickRate, int maxStepsPerFrame) :
+    _stepSeconds(1.0 / tickRate),
+    _accumulator(0.0),
+    _maxStepsPerFrame(std::max(maxStepsPerFrame, 1)),
+    _tick(0),
+    _droppedSteps(0) {}
+
+FixedTimestep::~FixedTimestep() {
+  if (_current == this) {
+    _current = nullptr;
+  }
+}
+
+int FixedTimestep::Accumulate(double elapsedSeconds) {
+  _accumulator += std::max(elapsedSeconds, 0.0);
+  int steps = static_cast<int>(_accumulator / _stepSeconds);
+  _accumulator -= steps * _stepSeconds;
+  if (steps > _maxStepsPerFrame) {
+    // NOTE: the fraction is kept so Alpha stays continuous, only the whole steps over the cap are dropped
+    _droppedSteps += static_cast<Uint64>(steps - _maxStepsPerFrame);
+    steps = _maxStepsPerFrame;
+  }
+  return steps;
+}
+
+void FixedTimestep::Step() { _tick++; }
+
+float FixedTimestep::DeltaTime() const { return static_cast<float>(_stepSeconds); }
+
+double FixedTimestep::TickRate() const { return 1.0 / _stepSeconds; }
+
+void FixedTimestep::SetTickRate(double tickRate) { _stepSeconds = 1.0 / tickRate; }
+
+float FixedTimestep::Alpha() const { return std::clamp(static_cast<float>(_accumulator / _stepSeconds), 0.0f, 1.0f); }
+
+Uint64 FixedTimestep::Tick() const { return _tick; }
+
+Uint64 FixedTimestep::DroppedSteps() const { return _droppedSteps; }
+
+void FixedTimestep::MakeCurrent() { _current = this; }
+
+Uint64 FixedTimestep::CurrentTick() { return _current != nullptr ? _current->_tick : 0; }
+
+float FixedTimestep::InterpolationAlpha() { return _current != nullptr ? _current->Alpha() : 1.0f; }
+
+InterpolatedPoint::InterpolatedPoint() : _previous{0.0f, 0.0f}, _current{0.0f, 0.0f}, _tick(0) {}
+
+void InterpolatedPoint::Update(float x, float y) {
+  Uint64 tick = FixedTimestep::CurrentTick();
+  if (tick != _tick) {
+    _previous = _current;
+    _tick = tick;
+  }
+  _current = SDL_FPoint{x, y};
+}
+
+void InterpolatedPoint::Reset(float x, float y) {
+  _previous = SDL_FPoint{x, y};
+  _current = _previous;
+  _tick = FixedTimestep::CurrentTick();
+}
+
+SDL_FPoint InterpolatedPoint::Get() const {
+  if (_tick != FixedTimestep::CurrentTick()) {
+    return _current;
+  }
+  float alpha = FixedTimestep::InterpolationAlpha();
+  return SDL_FPoint{_previous.x + (_current.x - _previous.x) * alpha,
+                    _previous.y + (_current.y - _previous.y) * alpha};
+}
+
+SDL_FPoint InterpolatedPoint::Current() const { return _current; }
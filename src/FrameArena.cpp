@@ -0,0 +1,62 @@
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace CoffeeMaker;
+
+FrameArena::FrameArena(size_t capacity) :
+    _memory(std::make_unique<std::byte[]>(capacity)),
+    _capacity(capacity),
+    _offset(0),
+    _overflow(),
+    _overflowUsed(0),
+    _highWater(0),
+    _overflows(0) {}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+  const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(_memory.get());
+  size_t start = static_cast<size_t>(Align(base + _offset, alignment) - base);
+  if (start + size <= _capacity) {
+    _offset = start + size;
+    _highWater = std::max(_highWater, Used());
+    return _memory.get() + start;
+  }
+
+  // NOTE: operator new[] only guarantees max_align_t, over-allocate so the block can be aligned by hand
+  size_t blockSize = size + alignment;
+  _overflow.push_back(std::make_unique<std::byte[]>(blockSize));
+  _overflowUsed += blockSize;
+  _overflows++;
+  _highWater = std::max(_highWater, Used());
+  void* block = _overflow.back().get();
+  return std::align(alignment, size, block, blockSize);
+}
+
+void FrameArena::Reset() {
+  if (!_overflow.empty()) {
+    // NOTE: grow once to fit the whole frame, with room to spare, so the next frame stays in a single block
+    _capacity = std::max(_capacity * 2, _highWater + _highWater / 2);
+    _memory = std::make_unique<std::byte[]>(_capacity);
+    _overflow.clear();
+    _overflowUsed = 0;
+  }
+  _offset = 0;
+}
+
+size_t FrameArena::Used() const { return _offset + _overflowUsed; }
+
+size_t FrameArena::Capacity() const { return _capacity; }
+
+size_t FrameArena::HighWater() const { return _highWater; }
+
+size_t FrameArena::Overflows() const { return _overflows; }
+
+FrameArena* FrameArena::Frame() {
+  static FrameArena arena;
+  return &arena;
+}
+
+std::uintptr_t FrameArena::Align(std::uintptr_t address, size_t alignment) {
+  return (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+}
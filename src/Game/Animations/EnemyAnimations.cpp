@@ -90,132 +90,74 @@ void Animations::SplineAnimation::OnStart(std::function<void(void *)> fn) { _sta
 
 void Animations::SplineAnimation::OnComplete(std::function<void(void *)> fn) { _completeListeners.push_back(fn); }
 
+void Animations::SplineAnimation::ProcessComplete() {
+  for (auto f : _completeListeners) {
+    f(nullptr);
+  }
+}
+
 //------------------------------------------------------------------------------------------
 //----- EnemyEntrance001 -------------------------------------------------------------------
 //------------------------------------------------------------------------------------------
 
-Scope<CoffeeMaker::BSpline> Animations::EnemyEntrance001::_bSpline = nullptr;
-Scope<CoffeeMaker::BSpline> Animations::EnemyEntrance001::_bSplineInverted = nullptr;
-
-void Animations::EnemyEntrance001::LoadBSpline() {
-  _bSpline = CreateScope<CoffeeMaker::BSpline>();
-  _bSpline->Load("splines/entrance001.spline");
-  _bSpline->RemapControlPoints();
-  _bSplineInverted = CreateScope<CoffeeMaker::BSpline>(_bSpline->NumControlPoints());
-  _bSplineInverted->SetControlPoints(_bSpline->InvertControlPoints());
+PathFollowerSystem::PathId Animations::EnemyEntrance001::Preload() {
+  return PathFollowerSystem::LoadPath("splines/entrance001.spline");
 }
 
-Animations::EnemyEntrance001::EnemyEntrance001(bool inverted, float duration) :
-    _inverted(inverted), _knot(0.0f), _currentTime(0.0f), _duration(duration) {
-  if (_bSplineInverted == nullptr) {
-    LoadBSpline();
-  }
+Animations::EnemyEntrance001::EnemyEntrance001(bool inverted, float duration) : _follower() {
+  _follower = PathFollowerSystem::Add(Preload(), duration, inverted, [this]() { ProcessComplete(); });
 }
 
-Animations::EnemyEntrance001::EnemyEntrance001(float duration) :
-    _inverted(false), _knot(0.0f), _currentTime(0.0f), _duration(duration) {
-  if (_bSpline == nullptr) {
-    LoadBSpline();
-  }
-}
+Animations::EnemyEntrance001::EnemyEntrance001(float duration) : EnemyEntrance001(false, duration) {}
 
-void Animations::EnemyEntrance001::Reset() {
-  _knot = 0.0f;
-  _currentTime = 0.0f;
-  if (_inverted) {
-    _currentPoint = _bSplineInverted->Point2DAtKnot(_knot);
-  } else {
-    _currentPoint = _bSpline->Point2DAtKnot(_knot);
-  }
-}
+Animations::EnemyEntrance001::~EnemyEntrance001() { PathFollowerSystem::Remove(_follower); }
 
-void Animations::EnemyEntrance001::Update(float deltaTime) {
-  _currentTime += deltaTime;
-  _knot = _currentTime / _duration;
-  if (_inverted) {
-    _currentPoint = _bSplineInverted->Point2DAtKnot(_knot);
-  } else {
-    _currentPoint = _bSpline->Point2DAtKnot(_knot);
-  }
-  if (_knot >= 1.0f) {
-    for (auto f : _completeListeners) {
-      f(nullptr);
-    }
-  }
-}
+void Animations::EnemyEntrance001::Reset() { PathFollowerSystem::Reset(_follower); }
+
+void Animations::EnemyEntrance001::Start() { PathFollowerSystem::Start(_follower); }
+
+void Animations::EnemyEntrance001::Stop() { PathFollowerSystem::Stop(_follower); }
 
 void Animations::EnemyEntrance001::SetFinalPosition(const CoffeeMaker::Math::Point2D &pos) {
-  if (_inverted) {
-    _bSplineInverted->SetControlPointAt(_bSplineInverted->NumControlPoints() - 1, pos);
-  } else {
-    _bSpline->SetControlPointAt(_bSpline->NumControlPoints() - 1, pos);
-  }
+  PathFollowerSystem::AnchorEnd(_follower, pos);
 }
 
-CoffeeMaker::Math::Point2D Animations::EnemyEntrance001::CurrentPosition() { return _currentPoint; }
+CoffeeMaker::Math::Point2D Animations::EnemyEntrance001::CurrentPosition() {
+  return PathFollowerSystem::Position(_follower);
+}
+
+bool Animations::EnemyEntrance001::Complete() const { return PathFollowerSystem::IsComplete(_follower); }
 
 //------------------------------------------------------------------------------------------
 //----- EnemyExite001 ----------------------------------------------------------------------
 //------------------------------------------------------------------------------------------
 
-Scope<CoffeeMaker::BSpline> Animations::EnemyExit001::_bSpline = nullptr;
-Scope<CoffeeMaker::BSpline> Animations::EnemyExit001::_bSplineInverted = nullptr;
-
-void Animations::EnemyExit001::LoadBSpline() {
-  _bSpline = CreateScope<CoffeeMaker::BSpline>();
-  _bSpline->Load("splines/exit001.spline");
-  _bSpline->RemapControlPoints();
-  _bSplineInverted = CreateScope<CoffeeMaker::BSpline>(_bSpline->NumControlPoints());
-  _bSplineInverted->SetControlPoints(_bSpline->InvertControlPoints());
+PathFollowerSystem::PathId Animations::EnemyExit001::Preload() {
+  return PathFollowerSystem::LoadPath("splines/exit001.spline");
 }
 
-Animations::EnemyExit001::EnemyExit001(float duration) :
-    _inverted(false), _knot(0.0f), _currentTime(0.0f), _duration(duration) {
-  if (_bSpline == nullptr) {
-    LoadBSpline();
-  }
+Animations::EnemyExit001::EnemyExit001(bool inverted, float duration) : _follower() {
+  _follower = PathFollowerSystem::Add(Preload(), duration, inverted, [this]() { ProcessComplete(); });
 }
 
-Animations::EnemyExit001::EnemyExit001(bool inverted, float duration) :
-    _inverted(inverted), _knot(0.0f), _currentTime(0.0f), _duration(duration) {
-  if (_bSplineInverted == nullptr) {
-    LoadBSpline();
-  }
-}
+Animations::EnemyExit001::EnemyExit001(float duration) : EnemyExit001(false, duration) {}
 
-void Animations::EnemyExit001::Reset() {
-  _knot = 0.0f;
-  _currentTime = 0.0f;
-  if (_inverted) {
-    _currentPoint = _bSplineInverted->Point2DAtKnot(_knot);
-  } else {
-    _currentPoint = _bSpline->Point2DAtKnot(_knot);
-  }
-}
+Animations::EnemyExit001::~EnemyExit001() { PathFollowerSystem::Remove(_follower); }
 
-void Animations::EnemyExit001::Update(float deltaTime) {
-  _currentTime += deltaTime;
-  _knot = _currentTime / _duration;
-  if (_inverted) {
-    _currentPoint = _bSplineInverted->Point2DAtKnot(_knot);
-  } else {
-    _currentPoint = _bSpline->Point2DAtKnot(_knot);
-  }
-  if (_knot >= 1.0f) {
-    for (auto f : _completeListeners) {
-      f(nullptr);
-    }
-  }
+void Animations::EnemyExit001::Reset() { PathFollowerSystem::Reset(_follower); }
+
+void Animations::EnemyExit001::Start() { PathFollowerSystem::Start(_follower); }
+
+void Animations::EnemyExit001::Stop() { PathFollowerSystem::Stop(_follower); }
+
+CoffeeMaker::Math::Point2D Animations::EnemyExit001::CurrentPosition() {
+  return PathFollowerSystem::Position(_follower);
 }
 
-CoffeeMaker::Math::Point2D Animations::EnemyExit001::CurrentPosition() { return _currentPoint; }
+bool Animations::EnemyExit001::Complete() const { return PathFollowerSystem::IsComplete(_follower); }
 
 void Animations::EnemyExit001::SetFirstPosition(const CoffeeMaker::Math::Point2D &pos) {
-  if (_inverted) {
-    _bSplineInverted->SetControlPointAt(0, pos);
-  } else {
-    _bSpline->SetControlPointAt(0, pos);
-  }
+  PathFollowerSystem::AnchorStart(_follower, pos);
 }
 
-void Animations::EnemyExit001::Invert(bool invert) { _inverted = invert; }
+void Animations::EnemyExit001::Invert(bool invert) { PathFollowerSystem::SetInverted(_follower, invert); }
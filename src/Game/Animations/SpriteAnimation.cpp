@@ -4,8 +4,9 @@ int Animations::SpriteAnimation::_uid = 0;
 std::vector<Animations::SpriteAnimation*> Animations::SpriteAnimation::_animations = {};
 
 void Animations::SpriteAnimation::ProcessSpriteAnimations() {
-  for (auto& animation : _animations) {
-    animation->Update();
+  // NOTE: by index, an OnComplete callback may destroy animations, the one moved into a freed slot waits a frame
+  for (size_t i = 0; i < _animations.size(); i++) {
+    _animations[i]->Update();
   }
 }
 
@@ -16,20 +17,19 @@ Animations::SpriteAnimation::SpriteAnimation(Ref<CoffeeMaker::Sprite> sprite, in
     _started(false),
     _durationPerFrame(0),
     _currentFrame(0),
-    _id(0) {
+    _id(0),
+    _index(0) {
   _id = ++_uid;
+  _index = _animations.size();
   _animations.push_back(this);
 }
 
 Animations::SpriteAnimation::~SpriteAnimation() {
-  for (auto animation = _animations.begin(); animation != _animations.end();) {
-    if (_id == (*animation)->_id) {
-      animation = _animations.erase(animation);
-      break;
-    } else {
-      ++animation;
-    }
-  }
+  // NOTE: the last animation takes over this slot, animations are updated in no particular order
+  SpriteAnimation* last = _animations.back();
+  _animations[_index] = last;
+  last->_index = _index;
+  _animations.pop_back();
 }
 
 void Animations::SpriteAnimation::Update() {
@@ -1,6 +1,8 @@
 #include "Game/Collider.hpp"
 
+#include <algorithm>
 #include <functional>
+#include <utility>
 
 #include "Color.hpp"
 #include "Logger.hpp"
@@ -8,32 +10,131 @@
 
 int Collider::_colliderId = 0;
 std::vector<Collider*> Collider::_colliders = {};
-std::queue<std::function<void()>> Collider::collisionQueue = {};
+std::vector<Collider::Contact> Collider::_contacts = {};
+Uint32 Collider::_numContacts = 0;
+Uint32 Collider::_peakContacts = 0;
+std::vector<Collider*> Collider::_activeColliders = {};
+std::vector<SDL_FRect> Collider::_activeRects = {};
+std::vector<std::uint32_t> Collider::_activeLayers = {};
+std::vector<std::uint32_t> Collider::_activeMasks = {};
+
+namespace {
+  constexpr std::uint32_t LayerBit(Collider::Type type) { return 1u << static_cast<std::uint32_t>(type); }
+
+  /**
+   * Default collides with everything, the gameplay types only with the types that
+   * have a response to them.
+   */
+  constexpr std::array<std::uint32_t, Collider::NUM_TYPES> DefaultLayerMatrix() {
+    std::array<std::uint32_t, Collider::NUM_TYPES> matrix{};
+    auto enable = [&matrix](Collider::Type a, Collider::Type b) {
+      matrix[static_cast<size_t>(a)] |= LayerBit(b);
+      matrix[static_cast<size_t>(b)] |= LayerBit(a);
+    };
+    for (size_t type = 0; type < Collider::NUM_TYPES; type++) {
+      enable(Collider::Type::Default, static_cast<Collider::Type>(type));
+    }
+    enable(Collider::Type::Projectile, Collider::Type::Enemy);
+    enable(Collider::Type::EnemyProjectile, Collider::Type::Player);
+    enable(Collider::Type::Enemy, Collider::Type::Player);
+    return matrix;
+  }
+}  // namespace
+
+std::array<std::uint32_t, Collider::NUM_TYPES> Collider::_layerMatrix = DefaultLayerMatrix();
+SpatialGrid Collider::_grid{};
 
 void Collider::PhysicsUpdate() {
+  _activeColliders.clear();
+  _activeRects.clear();
+  _activeLayers.clear();
+  _activeMasks.clear();
+  for (auto& collider : _colliders) {
+    std::uint32_t mask = _layerMatrix[static_cast<size_t>(collider->_type)];
+    // NOTE: a type that collides with nothing never needs to enter the grid
+    if (collider->active && mask != 0) {
+      _activeColliders.push_back(collider);
+      _activeRects.push_back(collider->clientRect);
+      _activeLayers.push_back(LayerBit(collider->_type));
+      _activeMasks.push_back(mask);
+    }
+  }
+
+  _grid.Build(_activeRects.data(), _activeRects.size(), _activeLayers.data(), _activeMasks.data());
+  _grid.ForEachPair([](std::uint32_t i, std::uint32_t j) { QueueContact(_activeColliders[i], _activeColliders[j]); });
+}
+
+void Collider::QueueContact(Collider* a, Collider* b) {
+  // NOTE: store pairs in a canonical order so repeated reports of the same pair sort next to each other
+  if (b->_id < a->_id) {
+    std::swap(a, b);
+  }
+  _contacts.push_back({a, b});
+}
+
+void Collider::CollectActive(CoffeeMaker::FrameVector<Collider*>& colliders) {
+  colliders.clear();
+  colliders.reserve(_colliders.size());
   for (auto& collider : _colliders) {
     if (collider->active) {
-      collider->CheckForCollision();
+      colliders.push_back(collider);
     }
   }
 }
 
-void Collider::ClearAllUnprocessedCollisions() {
-  while (!collisionQueue.empty()) {
-    collisionQueue.pop();
+void Collider::SetLayerCollision(Collider::Type a, Collider::Type b, bool collides) {
+  if (collides) {
+    _layerMatrix[static_cast<size_t>(a)] |= LayerBit(b);
+    _layerMatrix[static_cast<size_t>(b)] |= LayerBit(a);
+  } else {
+    _layerMatrix[static_cast<size_t>(a)] &= ~LayerBit(b);
+    _layerMatrix[static_cast<size_t>(b)] &= ~LayerBit(a);
   }
 }
 
+bool Collider::CanCollide(Collider::Type a, Collider::Type b) {
+  return (_layerMatrix[static_cast<size_t>(a)] & LayerBit(b)) != 0;
+}
+
+void Collider::ClearAllUnprocessedCollisions() { _contacts.clear(); }
+
 void Collider::ProcessCollisions() {
-  while (!collisionQueue.empty()) {
-    auto handleCollision = collisionQueue.front();
-    collisionQueue.pop();
-    handleCollision();
+  // NOTE: by id rather than address, so contacts are dispatched in the same order on every run. Contacts of
+  // destroyed colliders were nulled out, they sort first and are skipped.
+  auto id = [](const Collider* collider) { return collider != nullptr ? collider->_id : 0; };
+  auto byPair = [&id](const Contact& lhs, const Contact& rhs) {
+    return id(lhs.first) != id(rhs.first) ? id(lhs.first) < id(rhs.first) : id(lhs.second) < id(rhs.second);
+  };
+  auto samePair = [](const Contact& lhs, const Contact& rhs) {
+    return lhs.first == rhs.first && lhs.second == rhs.second;
+  };
+  std::sort(_contacts.begin(), _contacts.end(), byPair);
+  _contacts.erase(std::unique(_contacts.begin(), _contacts.end(), samePair), _contacts.end());
+
+  _numContacts = static_cast<Uint32>(_contacts.size());
+  _peakContacts = std::max(_peakContacts, _numContacts);
+
+  // NOTE: listeners may destroy colliders, which null out their contacts, so re-read each contact before every
+  // dispatch
+  for (size_t i = 0; i < _contacts.size(); i++) {
+    if (_contacts[i].first != nullptr && _contacts[i].second != nullptr) {
+      _contacts[i].first->OnCollision(_contacts[i].second);
+    }
+    if (_contacts[i].first != nullptr && _contacts[i].second != nullptr) {
+      _contacts[i].second->OnCollision(_contacts[i].first);
+    }
   }
+  _contacts.clear();
 }
 
-Collider::Collider(Collider::Type type, bool active) : active(active), _type(type), _id(-1) {
+Uint32 Collider::Contacts() { return _numContacts; }
+
+Uint32 Collider::PeakContacts() { return _peakContacts; }
+
+Collider::Collider(Collider::Type type, bool active) :
+    active(active), _type(type), _id(-1), _index(0), _dispatching(0) {
   _id = ++_colliderId;
+  _index = _colliders.size();
   _colliders.emplace_back(this);
   _texture.SetColor(CoffeeMaker::Colors::Green);
   clientRect.x = 0;
@@ -46,13 +147,17 @@ Collider::Collider(Collider::Type type, bool active) : active(active), _type(typ
 Collider::~Collider() {
   active = false;
   _listeners.clear();
-  for (auto colliderIter = _colliders.begin(); colliderIter != _colliders.end();) {
-    if ((*colliderIter)->_id == _id) {
-      colliderIter = _colliders.erase(colliderIter);
-      break;
+  for (auto& contact : _contacts) {
+    if (contact.first == this || contact.second == this) {
+      contact.first = nullptr;
+      contact.second = nullptr;
     }
-    ++colliderIter;
   }
+  // NOTE: the last collider takes over this slot, the broadphase does not depend on the order of _colliders
+  Collider* last = _colliders.back();
+  _colliders[_index] = last;
+  last->_index = _index;
+  _colliders.pop_back();
 }
 
 void Collider::SetWidth(float w) {
@@ -75,36 +180,36 @@ void Collider::Update(const SDL_FRect& position) {
 }
 
 void Collider::OnCollision(Collider* collider) {
-  for (auto listener : _listeners) {
+  _dispatching++;
+  for (auto& listener : _listeners) {
     listener(collider);
   }
-}
-
-void Collider::CheckForCollision() {
-  for (auto&& collider : _colliders) {
-    // NOTE: fitler out self, make sure the collider is active
-    if (collider->_id != _id && collider->active) {
-      if (_AxisAlignedBoundingBoxHit(collider)) {
-        collisionQueue.push(std::bind(&Collider::OnCollision, this, collider));
-      }
+  _dispatching--;
+  if (_dispatching == 0 && !_pendingListeners.empty()) {
+    for (auto& listener : _pendingListeners) {
+      _listeners.push_back(std::move(listener));
     }
+    _pendingListeners.clear();
   }
 }
 
 bool Collider::_AxisAlignedBoundingBoxHit(Collider* collider) const {
-  return clientRect.x < collider->clientRect.x + collider->clientRect.w &&
-         clientRect.x + clientRect.w > collider->clientRect.x &&
-
-         clientRect.y < collider->clientRect.y + collider->clientRect.h &&
-         clientRect.y + clientRect.h > collider->clientRect.y;
+  return SpatialGrid::Overlaps(clientRect, collider->clientRect);
 }
 
 void Collider::Render() {
+  CoffeeMaker::Renderer::Flush();
   SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), 0, 255, 0, 255);
   SDL_RenderDrawRectF(CoffeeMaker::Renderer::Instance(), &clientRect);
 }
 
-void Collider::OnCollide(std::function<void(Collider*)> callback) { _listeners.push_back(callback); }
+void Collider::OnCollide(std::function<void(Collider*)> callback) {
+  if (_dispatching > 0) {
+    _pendingListeners.push_back(callback);
+  } else {
+    _listeners.push_back(callback);
+  }
+}
 
 Collider::Type Collider::GetType() const { return _type; }
 
@@ -7,9 +7,9 @@
 #include <random>
 
 #include "Event.hpp"
+#include "EventBus.hpp"
 #include "Game/Events.hpp"
 #include "Game/Player.hpp"
-#include "Game/Scene.hpp"
 #include "Logger.hpp"
 #include "Renderer.hpp"
 #include "Utilities.hpp"
@@ -22,32 +22,32 @@ std::uniform_real_distribution<double> distribution(0, 360);
 Enemy::Enemy() :
     _id("Enemy-" + std::to_string(++_uid)),
     _active(false),
-    _rotation(0),
     _speed(250.0f),
-    _currentProjectile(0),
     _collider(nullptr),
     _sprite(CreateScope<CoffeeMaker::Sprite>("EnemyV1.png")),
+    _world(CoffeeMaker::ECS::World::Current()),
+    _entity(_world->Create()),
     _entranceSpline2(CreateScope<Animations::EnemyEntrance001>()),
     _exitSpline(CreateScope<Animations::EnemyExit001>()),
     // TIMEOUTS AND INTERVALS
     _fireMissileTask(CreateScope<CoffeeMaker::Async::IntervalTask>(
         [this] {
           CoffeeMaker::Logger::Trace("[ENEMY_EVENT][ENEMY_FIRE_MISSILE] - Enemy ID: {}", _id);
-          CoffeeMaker::PushUserEvent(UCI::Events::ENEMY_FIRE_MISSILE, -1, this);
+          CoffeeMaker::PublishEvent(UCI::Events::ENEMY_FIRE_MISSILE, -1, this);
         },
         3000)),
     _exitTimeoutTask(CreateScope<CoffeeMaker::Async::TimeoutTask>(
         "[ENEMY][EXIT-TIMEOUT-TASK] - " + _id,
         [this] {
           CoffeeMaker::Logger::Trace("[ENEMY_EVENT][EXIT-TIMEOUT-TASK] - Enemy ID: {}", _id);
-          CoffeeMaker::PushUserEvent(UCI::Events::ENEMY_BEGIN_EXIT, -1, this);
+          CoffeeMaker::PublishEvent(UCI::Events::ENEMY_BEGIN_EXIT, -1, this);
         },
         12000)),
     _respawnTimeoutTask(CreateScope<CoffeeMaker::Async::TimeoutTask>(
         "[ENEMY][RESPAWN-TIMEOUT-TASK] - " + _id,
         [this] {
           CoffeeMaker::Logger::Trace("[ENEMY_EVENT][RESPAWN-TIMEOUT-TASK] - Enemy ID: {}", _id);
-          CoffeeMaker::PushUserEvent(UCI::Events::ENEMY_COMPLETE_EXIT, -1, this);
+          CoffeeMaker::PublishEvent(UCI::Events::ENEMY_COMPLETE_EXIT, -1, this);
         },
         3000)),
 
@@ -56,11 +56,22 @@ Enemy::Enemy() :
     _impactSound(CreateScope<CoffeeMaker::AudioElement>("effects/ProjectileImpact.ogg")),
     _state(Enemy::State::Idle),
     _aggression(Enemy::AggressionState::Active) {
-  _position.x = 400;
-  _position.y = 150;
+  _world->Add<UCI::Components::Transform>(_entity, CoffeeMaker::Math::Vector2D{400, 150}, 0.0);
+
+  // NOTE: enemy events are routed to this enemy alone, only the player events are seen by every enemy
+  auto handler = [this](const SDL_UserEvent& event) { OnSDLUserEvent(event); };
+  CoffeeMaker::EventBus* bus = CoffeeMaker::EventBus::Instance();
+  for (Uint32 type : {UCI::Events::ENEMY_DESTROYED, UCI::Events::ENEMY_SPAWNED, UCI::Events::ENEMY_FIRE_MISSILE,
+                      UCI::Events::ENEMY_BEGIN_EXIT, UCI::Events::ENEMY_COMPLETE_EXIT}) {
+    _subscriptions.push_back(bus->Subscribe(type, this, handler));
+  }
+  for (Uint32 type :
+       {UCI::Events::PLAYER_DESTROYED, UCI::Events::PLAYER_LOST_GAME, UCI::Events::PLAYER_COMPLETE_SPAWN}) {
+    _subscriptions.push_back(bus->Subscribe(type, handler));
+  }
 
-  _sprite->clientRect.x = _position.x;
-  _sprite->clientRect.y = _position.y;
+  _sprite->clientRect.x = Transform().position.x;
+  _sprite->clientRect.y = Transform().position.y;
   _sprite->clientRect.w = 48 * CoffeeMaker::Renderer::DynamicResolutionDownScale();
   _sprite->clientRect.h = 48 * CoffeeMaker::Renderer::DynamicResolutionDownScale();
   _entranceSpline2->OnComplete([this](void*) {
@@ -82,12 +93,8 @@ Enemy::Enemy() :
   _collider->clientRect.h = _sprite->clientRect.h;
   _collider->clientRect.w = _sprite->clientRect.w;
   _collider->OnCollide(std::bind(&Enemy::OnCollision, this, std::placeholders::_1));
-
-  for (int i = 0; i < 50; i++) {
-    _projectiles.emplace_back(
-        new Projectile(Collider::Type::EnemyProjectile, Projectile::Type::Hostile, Projectile::Size::Small));
-  }
-  _currentProjectile = 0;
+  _world->Add<UCI::Components::Sprite>(_entity, _sprite.get());
+  _world->Add<UCI::Components::Body>(_entity, _collider.get());
 
   _destroyedAnimation->OnComplete([this] {
     CoffeeMaker::Logger::Trace("[ENEMY_EVENT][ENEMY_DESTROYED_ANIMATION] Complete Enemy ID: {}", _id);
@@ -98,17 +105,17 @@ Enemy::Enemy() :
 }
 
 Enemy::~Enemy() {
+  _world->Destroy(_entity);
   _destroyedAnimation->Stop();
   _exitTimeoutTask->Cancel();
   _fireMissileTask->Cancel();
   _respawnTimeoutTask->Cancel();
-  for (auto p : _projectiles) {
-    delete p;
-  }
 }
 
 void Enemy::Init() {}
 
+UCI::Components::Transform& Enemy::Transform() { return *_world->Get<UCI::Components::Transform>(_entity); }
+
 void Enemy::Render() {
   if (_state == Enemy::State::Destroyed) {
     _destroyedAnimation->Render();
@@ -117,10 +124,6 @@ void Enemy::Render() {
       _sprite->Render();
     }
   }
-
-  for (auto& projectile : _projectiles) {
-    projectile->Render();
-  }
 }
 
 void Enemy::Pause() {
@@ -138,63 +141,51 @@ void Enemy::Unpause() {
 void Enemy::Update(float deltaTime) {
   using Vec2 = CoffeeMaker::Math::Vector2D;
   using Pt2 = CoffeeMaker::Math::Point2D;
+  UCI::Components::Transform& transform = Transform();
 
   switch (_state) {
     case Enemy::State::StrafingLeft: {
-      _rotation = 180;
-      if (_position.x > 100 - _sprite->clientRect.w) {
-        _position += Vec2::Left() * _speed * deltaTime;
+      transform.rotation = 180;
+      if (transform.position.x > 100 - _sprite->clientRect.w) {
+        transform.position += Vec2::Left() * _speed * deltaTime;
       } else {
         _state = Enemy::State::StrafingRight;
       }
     } break;
     case Enemy::State::StrafingRight: {
-      _rotation = 180;
-      if (_position.x < 700) {
-        _position += Vec2::Right() * _speed * deltaTime;
+      transform.rotation = 180;
+      if (transform.position.x < 700) {
+        transform.position += Vec2::Right() * _speed * deltaTime;
       } else {
         _state = Enemy::State::StrafingLeft;
       }
     } break;
     case Enemy::State::Entering: {
-      if (!SceneManager::CurrentScenePaused()) {
-        _entranceSpline2->Update(deltaTime);
-      }
-
+      // NOTE: moved along by PathFollowerSystem::Update, before the enemies update
       Pt2 pt = _entranceSpline2->CurrentPosition();
       Vec2 currentPos{pt.x, pt.y};
 
-      _rotation = CoffeeMaker::Math::rad2deg(_position.LookAt(currentPos)) + 90;
-      _position = currentPos;
+      transform.rotation = CoffeeMaker::Math::rad2deg(transform.position.LookAt(currentPos)) + 90;
+      transform.position = currentPos;
     } break;
     case Enemy::State::Exiting: {
-      if (!SceneManager::CurrentScenePaused()) {
-        _exitSpline->Update(deltaTime);
-      }
-
+      // NOTE: moved along by PathFollowerSystem::Update, before the enemies update
       Pt2 pt = _exitSpline->CurrentPosition();
       Vec2 currentPos{pt.x, pt.y};
 
-      _rotation = CoffeeMaker::Math::rad2deg(_position.LookAt(currentPos)) + 90;
-      _position = currentPos;
+      transform.rotation = CoffeeMaker::Math::rad2deg(transform.position.LookAt(currentPos)) + 90;
+      transform.position = currentPos;
     } break;
     default: {
       // NOTE: do nothing for now...
     } break;
   }
-
-  _sprite->rotation = _rotation;
-  _sprite->SetPosition(_position);
-  _collider->Update(_sprite->clientRect);
-
-  for (auto& projectile : _projectiles) {
-    projectile->Update(deltaTime);
-  }
 }
 
 void Enemy::Spawn() {
   CoffeeMaker::Logger::Trace("[ENEMY][STATE_CHANGE][State=Entering] - {}", _id);
   _state = Enemy::State::Entering;
+  _entranceSpline2->Start();
   _collider->active = false;
   _collider->Update(_sprite->clientRect);
   _active = true;
@@ -206,14 +197,14 @@ bool Enemy::IsActive() const { return _active; }
 void Enemy::OnCollision(Collider* collider) {
   if (_collider->active) {
     if (collider->GetType() == Collider::Type::Projectile && _collider->active) {
-      CoffeeMaker::PushUserEvent(UCI::Events::ENEMY_DESTROYED, -1, this);
-      CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_INCREMENT_SCORE);
+      CoffeeMaker::PublishEvent(UCI::Events::ENEMY_DESTROYED, -1, this);
+      CoffeeMaker::PublishEvent(UCI::Events::PLAYER_INCREMENT_SCORE);
       return;
     }
 
     if (collider->GetType() == Collider::Type::Player && _collider->active) {
       _impactSound->Play();
-      CoffeeMaker::PushUserEvent(UCI::Events::ENEMY_DESTROYED, -1, this);
+      CoffeeMaker::PublishEvent(UCI::Events::ENEMY_DESTROYED, -1, this);
       return;
     }
   }
@@ -221,27 +212,18 @@ void Enemy::OnCollision(Collider* collider) {
 
 bool Enemy::IsOffScreen() const {
   // TODO: screen width and height should be dynamic
-  return _position.x + _sprite->clientRect.w <= 0 || _position.x >= 800 || _position.y + _sprite->clientRect.h <= 0 ||
-         _position.y >= 600;
+  const CoffeeMaker::Math::Vector2D& position = _world->Get<UCI::Components::Transform>(_entity)->position;
+  return position.x + _sprite->clientRect.w <= 0 || position.x >= 800 || position.y + _sprite->clientRect.h <= 0 ||
+         position.y >= 600;
 }
 
 void Enemy::Fire() {
-  // NOTE: sloppy but should kinda work for now
+  CoffeeMaker::Math::Vector2D position = Transform().position;
   float rot =
-      CoffeeMaker::Math::rad2deg(_position.LookAt(Player::Position())) + CoffeeMaker::Math::PolarRotate::QUARTER;
-  if (_currentProjectile < 24) {
-    if (!_projectiles[_currentProjectile + 1]->IsFired()) {
-      _projectiles[_currentProjectile++]->Fire2(_position.x, _position.y, Player::Position().x, Player::Position().y,
-                                                rot);
-    } else {
-      _currentProjectile += 2;
-    }
-  } else if (_currentProjectile == 24) {
-    _currentProjectile = 0;
-    // NOTE: fire the next, or else projectiles are unavailable for a frame.
-    _projectiles[_currentProjectile++]->Fire2(_position.x, _position.y, Player::Position().x, Player::Position().y,
-                                              rot);
-  }
+      CoffeeMaker::Math::rad2deg(position.LookAt(Player::Position())) + CoffeeMaker::Math::PolarRotate::QUARTER;
+  ProjectileSystem::FireAt(Collider::Type::EnemyProjectile, ProjectileSystem::Type::Hostile,
+                           ProjectileSystem::Size::Small, position.x, position.y, Player::Position().x,
+                           Player::Position().y, rot);
 }
 
 void Enemy::SetAggressionState(AggressionState state) { _aggression = state; }
@@ -252,11 +234,13 @@ void Enemy::OnSDLUserEvent(const SDL_UserEvent& event) {
     using Vec2 = CoffeeMaker::Math::Vector2D;
     _fireMissileTask->Cancel();
     _exitTimeoutTask->Cancel();
+    _entranceSpline2->Stop();
+    _exitSpline->Stop();
     _active = false;
     _collider->active = false;
     CoffeeMaker::Logger::Trace("[ENEMY][STATE_CHANGE][State=Destroyed] - {}", _id);
     _state = State::Destroyed;
-    _destroyedAnimation->SetPosition(Vec2{_position.x, _position.y});
+    _destroyedAnimation->SetPosition(Vec2{Transform().position.x, Transform().position.y});
     _destroyedAnimation->Start();
     return;
   }
@@ -279,8 +263,10 @@ void Enemy::OnSDLUserEvent(const SDL_UserEvent& event) {
     CoffeeMaker::Logger::Trace("[ENEMY_EVENT][ENEMY_BEGIN_EXIT]: Enemy ID: {}", _id);
     CoffeeMaker::Logger::Trace("[ENEMY][STATE_CHANGE][State=Exiting] - {}", _id);
     _state = State::Exiting;
-    _exitSpline->Invert(_position.x >= CoffeeMaker::Renderer::GetOutputWidthF() / 2);
-    _exitSpline->SetFirstPosition(Pt2{.x = _position.x, .y = _position.y});
+    const CoffeeMaker::Math::Vector2D& position = Transform().position;
+    _exitSpline->Invert(position.x >= CoffeeMaker::Renderer::GetOutputWidthF() / 2);
+    _exitSpline->SetFirstPosition(Pt2{.x = position.x, .y = position.y});
+    _exitSpline->Start();
     _fireMissileTask->Cancel();
     return;
   }
@@ -313,7 +299,7 @@ EchelonEnemy::EchelonEnemy() {
       "[ENEMY][EXIT-TIMEOUT-TASK] - " + _id,
       [this] {
         _echelonState = EchelonItem::EchelonState::Solo;
-        CoffeeMaker::PushUserEvent(UCI::Events::ENEMY_BEGIN_EXIT, -1, this);
+        CoffeeMaker::PublishEvent(UCI::Events::ENEMY_BEGIN_EXIT, -1, this);
         CoffeeMaker::Logger::Trace("[ENEMY_EVENT][EXIT-TIMEOUT-TASK] - Enemy ID: {}", _id);
       },
       12000);
@@ -322,13 +308,7 @@ EchelonEnemy::EchelonEnemy() {
 void EchelonEnemy::Update(float deltaTime) {
   if (_echelonState == EchelonItem::EchelonState::Synced) {
     // Synced state stuff
-    _sprite->rotation = 180;
-    _sprite->SetPosition(_position);
-    _collider->Update(_sprite->clientRect);
-
-    for (auto& projectile : _projectiles) {
-      projectile->Update(deltaTime);
-    }
+    Transform().rotation = 180;
   }
   if (_echelonState == EchelonItem::EchelonState::Solo) {
     // Solo state stuff
@@ -337,6 +317,7 @@ void EchelonEnemy::Update(float deltaTime) {
       using Pt2 = CoffeeMaker::Math::Point2D;
       using Vec2 = CoffeeMaker::Math::Vector2D;
       Vec2 currentPos = GetEchelonPosition();
+      // NOTE: samples the path again against the new end, Enemy::Update reads this frame's position, not the last
       _entranceSpline2->SetFinalPosition(Pt2{.x = currentPos.x, .y = currentPos.y});
     }
     Enemy::Update(deltaTime);
@@ -359,9 +340,10 @@ CoffeeMaker::Math::Vector2D EchelonEnemy::GetEchelonPosition() {
 }
 
 void EchelonEnemy::SetEchelonPosition(const Vec2& echelonPosition) {
-  _position.x = echelonPosition.x + (GetEchelonSpace() * static_cast<float>(_echelonIndex)) +
-                (_echelon->GetSpacing() * static_cast<float>(_echelonIndex));
-  _position.y = echelonPosition.y;
+  CoffeeMaker::Math::Vector2D& position = Transform().position;
+  position.x = echelonPosition.x + (GetEchelonSpace() * static_cast<float>(_echelonIndex)) +
+               (_echelon->GetSpacing() * static_cast<float>(_echelonIndex));
+  position.y = echelonPosition.y;
 }
 
 float EchelonEnemy::GetEchelonSpace() { return _sprite->clientRect.w; }
@@ -6,6 +6,7 @@
 
 #include "Color.hpp"
 #include "Event.hpp"
+#include "EventBus.hpp"
 #include "FontManager.hpp"
 #include "Game/Events.hpp"
 #include "Logger.hpp"
@@ -67,6 +68,12 @@ HeadsUpDisplay::HeadsUpDisplay() : _score(0), _life(3) {
   hudView->AppendChild(time);
   hudView->AppendChild(playerHealth);
 
+  auto handler = [this](const SDL_UserEvent& event) { OnSDLUserEvent(event); };
+  for (Uint32 type : {UCI::Events::HEADS_UP_DISPLAY_INCREMENT_TIMER, UCI::Events::PLAYER_INCREMENT_SCORE,
+                      UCI::Events::PLAYER_LOST_LIFE}) {
+    _subscriptions.push_back(CoffeeMaker::EventBus::Instance()->Subscribe(type, handler));
+  }
+
   _timer.Start();
   _timerId = SDL_AddTimer(1000, &HeadsUpDisplay::TimerInterval, this);
 }
@@ -76,7 +83,8 @@ void HeadsUpDisplay::Pause() { _timer.Pause(); }
 void HeadsUpDisplay::Unpause() { _timer.Unpause(); }
 
 Uint32 HeadsUpDisplay::TimerInterval(Uint32 interval, void*) {
-  CoffeeMaker::PushUserEvent(UCI::Events::HEADS_UP_DISPLAY_INCREMENT_TIMER);
+  // NOTE: runs on the SDL timer thread, publishing is safe from any thread
+  CoffeeMaker::PublishEvent(UCI::Events::HEADS_UP_DISPLAY_INCREMENT_TIMER);
   return interval;
 }
 
@@ -4,6 +4,7 @@
 #include "Event.hpp"
 #include "FontManager.hpp"
 #include "Game/Scene.hpp"
+#include "Renderer.hpp"
 
 Menu::Menu() : _active(false), _view(std::make_unique<View>()) {
   _view->clientRect.h = 500;
@@ -67,6 +68,7 @@ void Menu::RenderTransparentBackground() {
     CM_LOGGER_CRITICAL("Error setting SDL Draw Blend Mode to BLEND: {}", SDL_GetError());
   }
 
+  CoffeeMaker::Renderer::Flush();
   SDL_SetRenderDrawColor(_renderer, _backgroundColor.r, _backgroundColor.g, _backgroundColor.b, _backgroundColor.a);
   SDL_RenderFillRectF(_renderer, &_backgroundRect);
 
@@ -0,0 +1,316 @@
+#include "Game/PathFollowerSystem.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "MessageBox.hpp"
+#include "Renderer.hpp"
+#include "Spline.hpp"
+#include "ThreadPool.hpp"
+
+std::vector<PathFollowerSystem::SharedPaths> PathFollowerSystem::_paths = {};
+std::vector<std::string> PathFollowerSystem::_pathFiles = {};
+std::vector<const PathFollowerSystem::Paths*> PathFollowerSystem::_resolved = {};
+std::vector<PathFollowerSystem::PathId> PathFollowerSystem::_path = {};
+std::vector<float> PathFollowerSystem::_elapsed = {};
+std::vector<float> PathFollowerSystem::_duration = {};
+std::vector<float> PathFollowerSystem::_fraction = {};
+std::vector<float> PathFollowerSystem::_running = {};
+std::vector<std::uint8_t> PathFollowerSystem::_inverted = {};
+std::vector<std::uint8_t> PathFollowerSystem::_anchors = {};
+std::vector<CoffeeMaker::Math::Point2D> PathFollowerSystem::_startAnchor = {};
+std::vector<CoffeeMaker::Math::Point2D> PathFollowerSystem::_endAnchor = {};
+std::vector<CoffeeMaker::Math::Point2D> PathFollowerSystem::_position = {};
+std::vector<PathFollowerSystem::Callback> PathFollowerSystem::_onComplete = {};
+std::vector<PathFollowerSystem::FollowerId> PathFollowerSystem::_followers = {};
+std::vector<std::uint32_t> PathFollowerSystem::_slots = {};
+std::vector<std::uint32_t> PathFollowerSystem::_generations = {};
+std::vector<std::uint32_t> PathFollowerSystem::_free = {};
+std::vector<PathFollowerSystem::FollowerId> PathFollowerSystem::_completed = {};
+
+PathFollowerSystem::PathId PathFollowerSystem::LoadPath(const std::string& filePath) {
+  auto loaded = std::find(_pathFiles.begin(), _pathFiles.end(), filePath);
+  if (loaded != _pathFiles.end()) {
+    return static_cast<PathId>(loaded - _pathFiles.begin());
+  }
+  // NOTE: the output size is read here, on the main thread, the job only gets a copy of it
+  const float width = CoffeeMaker::Renderer::GetOutputWidthF();
+  const float height = CoffeeMaker::Renderer::GetOutputHeightF();
+  _paths.push_back(CoffeeMaker::Async::ThreadPool::Instance()
+                       ->Enqueue([filePath, width, height]() -> Ref<const Paths> {
+                         CoffeeMaker::BakedSpline path;
+                         if (!CoffeeMaker::BSpline::LoadBaked(filePath, width, height, path)) {
+                           // NOTE: reported by GetPaths, message boxes only work from the main thread
+                           return nullptr;
+                         }
+                         CoffeeMaker::BakedSpline inverted = path.Invert(width);
+                         return CreateRef<const Paths>(Paths{.path = std::move(path), .inverted = std::move(inverted)});
+                       })
+                       .share());
+  _pathFiles.push_back(filePath);
+  return static_cast<PathId>(_paths.size() - 1);
+}
+
+PathFollowerSystem::PathId PathFollowerSystem::AddPath(Paths paths) {
+  _paths.push_back(Ready(std::move(paths)));
+  // NOTE: never matched by LoadPath
+  _pathFiles.push_back("");
+  return static_cast<PathId>(_paths.size() - 1);
+}
+
+const PathFollowerSystem::Paths& PathFollowerSystem::GetPaths(PathId path) {
+  if (_paths[path].get() == nullptr) {
+    CoffeeMaker::MessageBox::ShowMessageBoxAndQuit("Error Reading File",
+                                                   "Could not load spline: \"" + _pathFiles[path] + "\"");
+    // NOTE: reported once, the game is quitting and followers of the path stand still until it does
+    const CoffeeMaker::BakedSpline stationary({{0.0f, 0.0f}, {0.0f, 0.0f}}, {0.0f, 0.0f});
+    _paths[path] = Ready(Paths{.path = stationary, .inverted = stationary});
+  }
+  return *_paths[path].get();
+}
+
+PathFollowerSystem::FollowerId PathFollowerSystem::Add(PathId path, float duration, bool inverted,
+                                                       Callback onComplete) {
+  FollowerId follower;
+  if (!_free.empty()) {
+    follower.index = _free.back();
+    _free.pop_back();
+  } else {
+    follower.index = static_cast<std::uint32_t>(_slots.size());
+    _slots.push_back(NO_SLOT);
+    _generations.push_back(0);
+  }
+  follower.generation = _generations[follower.index];
+  _slots[follower.index] = static_cast<std::uint32_t>(_followers.size());
+  _path.push_back(path);
+  _elapsed.push_back(0.0f);
+  _duration.push_back(std::max(duration, MIN_DURATION));
+  _fraction.push_back(0.0f);
+  _running.push_back(0.0f);
+  _inverted.push_back(static_cast<std::uint8_t>(inverted));
+  _anchors.push_back(0);
+  _startAnchor.push_back(CoffeeMaker::Math::Point2D{0.0f, 0.0f});
+  _endAnchor.push_back(CoffeeMaker::Math::Point2D{0.0f, 0.0f});
+  _position.push_back(CoffeeMaker::Math::Point2D{0.0f, 0.0f});
+  _onComplete.push_back(std::move(onComplete));
+  _followers.push_back(follower);
+  return follower;
+}
+
+void PathFollowerSystem::Remove(FollowerId follower) {
+  const std::uint32_t slot = Slot(follower);
+  if (slot == NO_SLOT) {
+    return;
+  }
+  const std::uint32_t last = static_cast<std::uint32_t>(_followers.size() - 1);
+  if (slot != last) {
+    _path[slot] = _path[last];
+    _elapsed[slot] = _elapsed[last];
+    _duration[slot] = _duration[last];
+    _fraction[slot] = _fraction[last];
+    _running[slot] = _running[last];
+    _inverted[slot] = _inverted[last];
+    _anchors[slot] = _anchors[last];
+    _startAnchor[slot] = _startAnchor[last];
+    _endAnchor[slot] = _endAnchor[last];
+    _position[slot] = _position[last];
+    _onComplete[slot] = std::move(_onComplete[last]);
+    _followers[slot] = _followers[last];
+    _slots[_followers[slot].index] = slot;
+  }
+  _path.pop_back();
+  _elapsed.pop_back();
+  _duration.pop_back();
+  _fraction.pop_back();
+  _running.pop_back();
+  _inverted.pop_back();
+  _anchors.pop_back();
+  _startAnchor.pop_back();
+  _endAnchor.pop_back();
+  _position.pop_back();
+  _onComplete.pop_back();
+  _followers.pop_back();
+  _slots[follower.index] = NO_SLOT;
+  _generations[follower.index]++;
+  _free.push_back(follower.index);
+}
+
+void PathFollowerSystem::Start(FollowerId follower) {
+  const std::uint32_t slot = Slot(follower);
+  if (slot == NO_SLOT) {
+    return;
+  }
+  _running[slot] = 1.0f;
+}
+
+void PathFollowerSystem::Stop(FollowerId follower) {
+  const std::uint32_t slot = Slot(follower);
+  if (slot == NO_SLOT) {
+    return;
+  }
+  _running[slot] = 0.0f;
+}
+
+void PathFollowerSystem::Reset(FollowerId follower) {
+  const std::uint32_t slot = Slot(follower);
+  if (slot == NO_SLOT) {
+    return;
+  }
+  _running[slot] = 0.0f;
+  _elapsed[slot] = 0.0f;
+  _fraction[slot] = 0.0f;
+  Sample(slot, GetPaths(_path[slot]));
+}
+
+void PathFollowerSystem::SetInverted(FollowerId follower, bool inverted) {
+  const std::uint32_t slot = Slot(follower);
+  if (slot == NO_SLOT) {
+    return;
+  }
+  _inverted[slot] = static_cast<std::uint8_t>(inverted);
+}
+
+void PathFollowerSystem::AnchorStart(FollowerId follower, const CoffeeMaker::Math::Point2D& position) {
+  const std::uint32_t slot = Slot(follower);
+  if (slot == NO_SLOT) {
+    return;
+  }
+  _anchors[slot] |= ANCHOR_START;
+  _startAnchor[slot] = position;
+  SampleIfLoaded(slot);
+}
+
+void PathFollowerSystem::AnchorEnd(FollowerId follower, const CoffeeMaker::Math::Point2D& position) {
+  const std::uint32_t slot = Slot(follower);
+  if (slot == NO_SLOT) {
+    return;
+  }
+  _anchors[slot] |= ANCHOR_END;
+  _endAnchor[slot] = position;
+  SampleIfLoaded(slot);
+}
+
+CoffeeMaker::Math::Point2D PathFollowerSystem::Position(FollowerId follower) {
+  const std::uint32_t slot = Slot(follower);
+  return slot != NO_SLOT ? _position[slot] : CoffeeMaker::Math::Point2D{0.0f, 0.0f};
+}
+
+bool PathFollowerSystem::IsRunning(FollowerId follower) {
+  const std::uint32_t slot = Slot(follower);
+  return slot != NO_SLOT && _running[slot] > 0.0f;
+}
+
+bool PathFollowerSystem::IsComplete(FollowerId follower) {
+  const std::uint32_t slot = Slot(follower);
+  return slot != NO_SLOT && _fraction[slot] >= 1.0f;
+}
+
+size_t PathFollowerSystem::Count() { return _followers.size(); }
+
+void PathFollowerSystem::Update(float deltaTime) {
+  const size_t count = _followers.size();
+  if (count == 0) {
+    return;
+  }
+  // NOTE: resolved on first use, a path that is still loading only blocks once one of its followers runs
+  _resolved.assign(_paths.size(), nullptr);
+
+  Advance(_elapsed.data(), _fraction.data(), _duration.data(), _running.data(), count, deltaTime);
+
+  _completed.clear();
+  for (size_t i = 0; i < count; i++) {
+    if (_running[i] > 0.0f) {
+      const Paths*& paths = _resolved[_path[i]];
+      if (paths == nullptr) {
+        paths = &GetPaths(_path[i]);
+      }
+      Sample(i, *paths);
+      if (_fraction[i] >= 1.0f) {
+        _running[i] = 0.0f;
+        _completed.push_back(_followers[i]);
+      }
+    }
+  }
+
+  // NOTE: after the whole pass, a callback may add or remove followers and move the others to other slots
+  for (FollowerId follower : _completed) {
+    const std::uint32_t slot = Slot(follower);
+    if (slot != NO_SLOT && _onComplete[slot]) {
+      // NOTE: a copy, the callback may remove its own follower
+      Callback onComplete = _onComplete[slot];
+      onComplete();
+    }
+  }
+}
+
+void PathFollowerSystem::Advance(float* elapsed, float* fraction, const float* duration, const float* running,
+                                 size_t count, float deltaTime) {
+  // NOTE: no branches, stopped followers advance by 0, so the loop vectorizes
+  for (size_t i = 0; i < count; i++) {
+    elapsed[i] += deltaTime * running[i];
+    fraction[i] = std::min(elapsed[i] / duration[i], 1.0f);
+  }
+}
+
+void PathFollowerSystem::Destroy() {
+  _paths.clear();
+  _pathFiles.clear();
+  _resolved.clear();
+  _path.clear();
+  _elapsed.clear();
+  _duration.clear();
+  _fraction.clear();
+  _running.clear();
+  _inverted.clear();
+  _anchors.clear();
+  _startAnchor.clear();
+  _endAnchor.clear();
+  _position.clear();
+  _onComplete.clear();
+  _followers.clear();
+  _completed.clear();
+  // NOTE: the indices are kept for the next followers, ids handed out before stop resolving
+  _free.clear();
+  for (std::uint32_t index = 0; index < _slots.size(); index++) {
+    _slots[index] = NO_SLOT;
+    _generations[index]++;
+    _free.push_back(index);
+  }
+}
+
+std::uint32_t PathFollowerSystem::Slot(FollowerId follower) {
+  if (follower.index >= _slots.size() || _generations[follower.index] != follower.generation) {
+    return NO_SLOT;
+  }
+  return _slots[follower.index];
+}
+
+PathFollowerSystem::SharedPaths PathFollowerSystem::Ready(Paths paths) {
+  std::promise<Ref<const Paths>> baked;
+  baked.set_value(CreateRef<const Paths>(std::move(paths)));
+  return baked.get_future().share();
+}
+
+void PathFollowerSystem::SampleIfLoaded(size_t slot) {
+  const SharedPaths& paths = _paths[_path[slot]];
+  if (paths.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+    Sample(slot, GetPaths(_path[slot]));
+  }
+}
+
+void PathFollowerSystem::Sample(size_t slot, const Paths& paths) {
+  const CoffeeMaker::BakedSpline& path = _inverted[slot] ? paths.inverted : paths.path;
+  CoffeeMaker::Math::Point2D startOffset{0.0f, 0.0f};
+  CoffeeMaker::Math::Point2D endOffset{0.0f, 0.0f};
+  // NOTE: worked out against the path in use when sampling, the follower may be inverted after it was anchored
+  if (_anchors[slot] & ANCHOR_START) {
+    startOffset = CoffeeMaker::Math::Point2D{.x = _startAnchor[slot].x - path.First().x,
+                                             .y = _startAnchor[slot].y - path.First().y};
+  }
+  if (_anchors[slot] & ANCHOR_END) {
+    endOffset =
+        CoffeeMaker::Math::Point2D{.x = _endAnchor[slot].x - path.Last().x, .y = _endAnchor[slot].y - path.Last().y};
+  }
+  _position[slot] = path.Point2DAtDistance(_fraction[slot], startOffset, endOffset);
+}
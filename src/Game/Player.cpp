@@ -6,6 +6,7 @@
 #include <glm/glm.hpp>
 
 #include "Event.hpp"
+#include "EventBus.hpp"
 #include "Game/Events.hpp"
 #include "Game/Scene.hpp"
 #include "Game/ScoreManager.hpp"
@@ -16,13 +17,13 @@
 
 Player* Player::_instance = nullptr;
 
-CoffeeMaker::Math::Vector2D Player::Position() {
-  return CoffeeMaker::Math::Vector2D(_instance->_clientRect.x, _instance->_clientRect.y);
-}
+CoffeeMaker::Math::Vector2D Player::Position() { return _instance->Transform().position; }
 
 Player::Player() :
     _isImmune(false),
     _collider(new Collider(Collider::Type::Player, true)),
+    _world(CoffeeMaker::ECS::World::Current()),
+    _entity(_world->Create()),
     _active(true),
     _destroyed(false),
     _lives(3),
@@ -31,20 +32,20 @@ Player::Player() :
         "[PLAYER][RESPAWN-TASK]",
         [] {
           CoffeeMaker::Logger::Debug("[PLAYER_EVENT] - PLAYER_WILL_SPAWN");
-          CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_POWER_UP_GAINED_IMMUNITY);
-          CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_COMPLETE_SPAWN);
+          CoffeeMaker::PublishEvent(UCI::Events::PLAYER_POWER_UP_GAINED_IMMUNITY);
+          CoffeeMaker::PublishEvent(UCI::Events::PLAYER_COMPLETE_SPAWN);
         },
         3000)),
     _asyncImmunityTask(CreateScope<CoffeeMaker::Async::TimeoutTask>(
         "[PLAYER][IMMUNITY-POWER-UP-DURATION]",
-        [] { CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_POWER_UP_LOST_IMMUNITY); }, 3000)),
+        [] { CoffeeMaker::PublishEvent(UCI::Events::PLAYER_POWER_UP_LOST_IMMUNITY); }, 3000)),
     _impactSound(CreateScope<CoffeeMaker::AudioElement>("effects/ProjectileImpact.ogg")),
     _oscillation(CreateScope<CoffeeMaker::Math::Oscillate>(128.0f, 255.0f, 0.025f)),
     _fireDelay(CreateScope<CoffeeMaker::Async::TimeoutTask>(
         "[PLAYER][FIRE-MISSILE-DELAY]",
         [] {
           CoffeeMaker::Logger::Debug("[PLAYER_EVENT] - FIRE-MISSILE-DELAY event was pushed");
-          CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_FIRE_DELAY_END);
+          CoffeeMaker::PublishEvent(UCI::Events::PLAYER_FIRE_DELAY_END);
         },
         250)),
     _fireMissileState(Player::FireMissileState::Unlocked),
@@ -57,35 +58,39 @@ Player::Player() :
   _firing = false;
   SDL_Rect vp;
   SDL_RenderGetViewport(CoffeeMaker::Renderer::Instance(), &vp);
-  _clientRect.x = (vp.w - _clientRect.w) / 2;
-  _clientRect.y = (vp.h - _clientRect.h) - 50;
-  for (int i = 0; i < 25; i++) {
-    _projectiles.emplace_back(
-        new Projectile(Collider::Type::Projectile, Projectile::Type::Friendly, Projectile::Size::Small));
-  }
-  _currentProjectile = 0;
+  CoffeeMaker::Math::Vector2D position{(vp.w - _clientRect.w) / 2, (vp.h - _clientRect.h) - 50};
+  _world->Add<UCI::Components::Transform>(_entity, position, -90.0);
+  _renderPosition.Reset(position.x, position.y);
   _collider->clientRect.h = _clientRect.h;
   _collider->clientRect.w = _clientRect.w;
-  _collider->Update(_clientRect);
+  _collider->Update(SDL_FRect{.x = position.x, .y = position.y, .w = _clientRect.w, .h = _clientRect.h});
   _collider->OnCollide(std::bind(&Player::OnHit, this, std::placeholders::_1));
-  _destroyedAnimation->OnComplete([] { CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_BEGIN_SPAWN); });
+  _world->Add<UCI::Components::Body>(_entity, _collider);
+  _destroyedAnimation->OnComplete([] { CoffeeMaker::PublishEvent(UCI::Events::PLAYER_BEGIN_SPAWN); });
   _oscillation->OnEnd = [this] {
     _isImmune = false;
     _texture.SetAlpha(255);
   };
+  // NOTE: gameplay events arrive through the event bus, pause and unpause still come through the SDL queue
+  auto handler = [this](const SDL_UserEvent& event) { OnSDLUserEvent(event); };
+  for (Uint32 type : {UCI::Events::PLAYER_POWER_UP_GAINED, UCI::Events::PLAYER_POWER_UP_LOST,
+                      UCI::Events::PLAYER_BEGIN_SPAWN, UCI::Events::PLAYER_POWER_UP_GAINED_IMMUNITY,
+                      UCI::Events::PLAYER_POWER_UP_LOST_IMMUNITY, UCI::Events::PLAYER_COMPLETE_SPAWN,
+                      UCI::Events::PLAYER_FIRE_DELAY_END, UCI::Events::PLAYER_DESTROYED,
+                      UCI::Events::PLAYER_LOST_GAME}) {
+    _subscriptions.push_back(CoffeeMaker::EventBus::Instance()->Subscribe(type, handler));
+  }
   _instance = this;
 }
 
 Player::~Player() {
+  _world->Destroy(_entity);
   _asyncRespawnTask->Cancel();
   _asyncImmunityTask->Cancel();
   _destroyedAnimation->Stop();
   _fireDelay->Cancel();
   _instance = nullptr;
   delete _collider;
-  for (auto p : _projectiles) {
-    delete p;
-  }
   _instance = nullptr;
 }
 
@@ -107,24 +112,27 @@ void Player::HandleDestroy(Collider* collider) {
   _collider->active = false;
   _active = false;
   if (_lives - 1 == 0) {
-    CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_LOST_GAME);
+    CoffeeMaker::PublishEvent(UCI::Events::PLAYER_LOST_GAME);
     return;
   }
   _lives--;
-  CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_LOST_LIFE);
-  CoffeeMaker::PushUserEvent(UCI::Events::PLAYER_DESTROYED);
+  CoffeeMaker::PublishEvent(UCI::Events::PLAYER_LOST_LIFE);
+  CoffeeMaker::PublishEvent(UCI::Events::PLAYER_DESTROYED);
   CoffeeMaker::Logger::Debug("[PLAYER_EVENT]-PLAYER_DESTROYED {}", collider->ToString());
 }
 
 void Player::Init() {}
 
+UCI::Components::Transform& Player::Transform() { return *_world->Get<UCI::Components::Transform>(_entity); }
+
 void Player::Pause() {}
 
 void Player::Unpause() {}
 
 void Player::Update(float deltaTime) {
   if (_active) {
-    _rotation = -90;
+    UCI::Components::Transform& transform = Transform();
+    transform.rotation = -90;
 
     if (CoffeeMaker::InputManager::IsKeyPressed(SDL_SCANCODE_W)) {
       _warpPowerup->Use();
@@ -139,22 +147,18 @@ void Player::Update(float deltaTime) {
 
     if (CoffeeMaker::InputManager::IsKeyDown(SDL_SCANCODE_LEFT)) {
       // strafe left
-      _clientRect.x = std::max(_clientRect.x - deltaTime * _speed, 50.0f);
-      _rotation -= 8;
+      transform.position.x = std::max(transform.position.x - deltaTime * _speed, 50.0f);
+      transform.rotation -= 8;
     }
 
     if (CoffeeMaker::InputManager::IsKeyDown(SDL_SCANCODE_RIGHT)) {
       // strafe right
-      _clientRect.x = std::min(_clientRect.x + deltaTime * _speed, CoffeeMaker::Renderer::GetOutputWidth() - 50.0f);
-      _rotation += 8;
+      transform.position.x =
+          std::min(transform.position.x + deltaTime * _speed, CoffeeMaker::Renderer::GetOutputWidth() - 50.0f);
+      transform.rotation += 8;
     }
 
-    _collider->Update(_clientRect);
-  }
-
-  // NOTE: projectiles that have already been fired are still fine to be updated
-  for (auto& projectile : _projectiles) {
-    projectile->Update(deltaTime);
+    _renderPosition.Update(transform.position.x, transform.position.y);
   }
 
   if (_isImmune && !_oscillation->Ended()) {
@@ -168,42 +172,25 @@ void Player::Render() {
   }
 
   if (_active) {
-    _texture.Render(_clipRect, _clientRect, _rotation + 90);
+    SDL_FPoint position = _renderPosition.Get();
+    SDL_FRect renderRect{position.x, position.y, _clientRect.w, _clientRect.h};
+    _texture.Render(_clipRect, renderRect, Transform().rotation + 90);
     // _collider->Render();
   }
-
-  // NOTE: projectiles that have already been fired are still fine to be rendered
-  for (auto& projectile : _projectiles) {
-    projectile->Render();
-  }
 }
 
 void Player::Fire() {
-  // NOTE: sloppy but should kinda work for now
-  if (_currentProjectile < 24) {
-    if (!_projectiles[_currentProjectile + 1]->IsFired()) {
-      _projectiles[_currentProjectile++]->Fire((float)_clientRect.x, (float)_clientRect.y, _rotation);
-    } else {
-      _currentProjectile += 2;
-    }
-  } else if (_currentProjectile == 24) {
-    _currentProjectile = 0;
-    // NOTE: fire the next, or else projectiles are unavailable for a frame.
-    _projectiles[_currentProjectile++]->Fire((float)_clientRect.x, (float)_clientRect.y, _rotation);
-  }
+  const UCI::Components::Transform& transform = Transform();
+  ProjectileSystem::Fire(Collider::Type::Projectile, ProjectileSystem::Type::Friendly, ProjectileSystem::Size::Small,
+                         transform.position.x, transform.position.y, transform.rotation);
   CoffeeMaker::Logger::Debug("[PLAYER_EVENT] - FIRED-MISSILE");
   _fireMissileState = Player::FireMissileState::Locked;
 }
 
-void Player::Reload() {
-  for (auto& projectile : _projectiles) {
-    projectile->Reload();
-  }
-  _currentProjectile = 0;
-}
+void Player::Reload() { ProjectileSystem::ReloadAll(Collider::Type::Projectile); }
 
-bool Player::IsOffScreenLeft() { return _clientRect.x + _clientRect.w <= 0; }
-bool Player::IsOffScreenRight() { return _clientRect.x >= 800; }
+bool Player::IsOffScreenLeft() { return Transform().position.x + _clientRect.w <= 0; }
+bool Player::IsOffScreenRight() { return Transform().position.x >= 800; }
 
 void Player::HandlePowerUpGained(Sint32 event) {
   if (event == UCI::PowerUp::PowerUpType::Warp) {
@@ -278,14 +265,14 @@ void Player::OnSDLUserEvent(const SDL_UserEvent& event) {
 
   if (event.type == UCI::Events::PLAYER_DESTROYED) {
     _destroyed = true;
-    _destroyedAnimation->SetPosition(CoffeeMaker::Math::Vector2D{_clientRect.x, _clientRect.y});
+    _destroyedAnimation->SetPosition(Transform().position);
     _destroyedAnimation->Start();
   }
 
   if (event.type == UCI::Events::PLAYER_LOST_GAME) {
     _destroyed = true;
-    _destroyedAnimation->OnComplete([] { CoffeeMaker::PushUserEvent(UCI::LOAD_NEW_SCENE, 2); });
-    _destroyedAnimation->SetPosition(CoffeeMaker::Math::Vector2D{_clientRect.x, _clientRect.y});
+    _destroyedAnimation->OnComplete([] { CoffeeMaker::PublishEvent(UCI::LOAD_NEW_SCENE, 2); });
+    _destroyedAnimation->SetPosition(Transform().position);
     _destroyedAnimation->Start();
   }
 }
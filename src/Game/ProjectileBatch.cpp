@@ -0,0 +1,99 @@
+#include "Game/ProjectileBatch.hpp"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define COFFEEMAKER_PROJECTILE_BATCH_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COFFEEMAKER_PROJECTILE_BATCH_SSE2
+#endif
+
+namespace {
+  inline void IntegrateRange(float* x, float* y, const float* velocityX, const float* velocityY, std::uint8_t* alive,
+                             size_t begin, size_t end, float deltaTime, const ProjectileBatch::Bounds& bounds) {
+    for (size_t i = begin; i < end; i++) {
+      x[i] += velocityX[i] * deltaTime;
+      y[i] += velocityY[i] * deltaTime;
+      bool offScreen = x[i] <= -bounds.width || x[i] >= bounds.outputWidth || y[i] <= -bounds.height ||
+                       y[i] >= bounds.outputHeight;
+      alive[i] &= static_cast<std::uint8_t>(!offScreen);
+    }
+  }
+
+  /**
+   * Clears the alive flag of every lane whose bit is set in the off screen mask.
+   */
+  inline void ApplyReloadMask(std::uint8_t* alive, int offScreenMask, int lanes) {
+    for (int lane = 0; lane < lanes; lane++) {
+      alive[lane] &= static_cast<std::uint8_t>(((offScreenMask >> lane) & 1) ^ 1);
+    }
+  }
+}  // namespace
+
+void ProjectileBatch::IntegrateScalar(float* x, float* y, const float* velocityX, const float* velocityY,
+                                      std::uint8_t* alive, size_t count, float deltaTime, const Bounds& bounds) {
+  IntegrateRange(x, y, velocityX, velocityY, alive, 0, count, deltaTime, bounds);
+}
+
+#if defined(COFFEEMAKER_PROJECTILE_BATCH_AVX)
+
+void ProjectileBatch::Integrate(float* x, float* y, const float* velocityX, const float* velocityY,
+                                std::uint8_t* alive, size_t count, float deltaTime, const Bounds& bounds) {
+  const __m256 dt = _mm256_set1_ps(deltaTime);
+  // NOTE: x + width <= 0 is tested as x <= -width so every lane compares against a constant
+  const __m256 minX = _mm256_set1_ps(-bounds.width);
+  const __m256 minY = _mm256_set1_ps(-bounds.height);
+  const __m256 maxX = _mm256_set1_ps(bounds.outputWidth);
+  const __m256 maxY = _mm256_set1_ps(bounds.outputHeight);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 px = _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(_mm256_loadu_ps(velocityX + i), dt));
+    __m256 py = _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(_mm256_loadu_ps(velocityY + i), dt));
+    _mm256_storeu_ps(x + i, px);
+    _mm256_storeu_ps(y + i, py);
+    __m256 offScreenX = _mm256_or_ps(_mm256_cmp_ps(px, minX, _CMP_LE_OQ), _mm256_cmp_ps(px, maxX, _CMP_GE_OQ));
+    __m256 offScreenY = _mm256_or_ps(_mm256_cmp_ps(py, minY, _CMP_LE_OQ), _mm256_cmp_ps(py, maxY, _CMP_GE_OQ));
+    __m256 offScreen = _mm256_or_ps(offScreenX, offScreenY);
+    ApplyReloadMask(alive + i, _mm256_movemask_ps(offScreen), 8);
+  }
+  IntegrateRange(x, y, velocityX, velocityY, alive, i, count, deltaTime, bounds);
+}
+
+const char* ProjectileBatch::InstructionSet() { return "AVX"; }
+
+#elif defined(COFFEEMAKER_PROJECTILE_BATCH_SSE2)
+
+void ProjectileBatch::Integrate(float* x, float* y, const float* velocityX, const float* velocityY,
+                                std::uint8_t* alive, size_t count, float deltaTime, const Bounds& bounds) {
+  const __m128 dt = _mm_set1_ps(deltaTime);
+  // NOTE: x + width <= 0 is tested as x <= -width so every lane compares against a constant
+  const __m128 minX = _mm_set1_ps(-bounds.width);
+  const __m128 minY = _mm_set1_ps(-bounds.height);
+  const __m128 maxX = _mm_set1_ps(bounds.outputWidth);
+  const __m128 maxY = _mm_set1_ps(bounds.outputHeight);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128 px = _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(velocityX + i), dt));
+    __m128 py = _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(velocityY + i), dt));
+    _mm_storeu_ps(x + i, px);
+    _mm_storeu_ps(y + i, py);
+    __m128 offScreenX = _mm_or_ps(_mm_cmple_ps(px, minX), _mm_cmpge_ps(px, maxX));
+    __m128 offScreenY = _mm_or_ps(_mm_cmple_ps(py, minY), _mm_cmpge_ps(py, maxY));
+    __m128 offScreen = _mm_or_ps(offScreenX, offScreenY);
+    ApplyReloadMask(alive + i, _mm_movemask_ps(offScreen), 4);
+  }
+  IntegrateRange(x, y, velocityX, velocityY, alive, i, count, deltaTime, bounds);
+}
+
+const char* ProjectileBatch::InstructionSet() { return "SSE2"; }
+
+#else
+
+void ProjectileBatch::Integrate(float* x, float* y, const float* velocityX, const float* velocityY,
+                                std::uint8_t* alive, size_t count, float deltaTime, const Bounds& bounds) {
+  IntegrateRange(x, y, velocityX, velocityY, alive, 0, count, deltaTime, bounds);
+}
+
+const char* ProjectileBatch::InstructionSet() { return "Scalar"; }
+
+#endif
@@ -0,0 +1,220 @@
+#include "Game/ProjectileSystem.hpp"
+
+#include <cmath>
+#include <glm/glm.hpp>
+
+#include "FixedTimestep.hpp"
+#include "FrameArena.hpp"
+#include "Game/ProjectileBatch.hpp"
+#include "Renderer.hpp"
+
+std::vector<float> ProjectileSystem::_x = {};
+std::vector<float> ProjectileSystem::_y = {};
+std::vector<float> ProjectileSystem::_velocityX = {};
+std::vector<float> ProjectileSystem::_velocityY = {};
+std::vector<float> ProjectileSystem::_rotation = {};
+std::vector<std::uint8_t> ProjectileSystem::_texture = {};
+std::vector<std::uint8_t> ProjectileSystem::_alive = {};
+std::vector<Collider::Type> ProjectileSystem::_colliderType = {};
+std::array<Ref<CoffeeMaker::Texture>, ProjectileSystem::NUM_TEXTURES> ProjectileSystem::_textures = {};
+Ref<CoffeeMaker::AudioElement> ProjectileSystem::_fireSound = nullptr;
+Ref<CoffeeMaker::AudioElement> ProjectileSystem::_impactSound = nullptr;
+std::array<Scope<Collider>, Collider::NUM_TYPES> ProjectileSystem::_proxies = {};
+float ProjectileSystem::_width = 16.0f;
+float ProjectileSystem::_height = 16.0f;
+float ProjectileSystem::_speed = ProjectileSystem::SPEED;
+float ProjectileSystem::_outputWidth = 0.0f;
+float ProjectileSystem::_outputHeight = 0.0f;
+float ProjectileSystem::_lastDeltaTime = 0.0f;
+
+void ProjectileSystem::Init() {
+  if (_textures[0] == nullptr) {
+    // NOTE: indexed by (Type * 2 + Size)
+    _textures[0] = CreateRef<CoffeeMaker::Texture>("Laser-Large-Green.png");
+    _textures[1] = CreateRef<CoffeeMaker::Texture>("Laser-Small-Green.png");
+    _textures[2] = CreateRef<CoffeeMaker::Texture>("Laser-Large-Red.png");
+    _textures[3] = CreateRef<CoffeeMaker::Texture>("Laser-Small-Red.png");
+  }
+  if (_fireSound == nullptr) {
+    _fireSound = CreateRef<CoffeeMaker::AudioElement>("effects/StandardMissileFire.ogg");
+  }
+  if (_impactSound == nullptr) {
+    _impactSound = CreateRef<CoffeeMaker::AudioElement>("effects/ProjectileImpact.ogg");
+  }
+  _width = 16 * CoffeeMaker::Renderer::DynamicResolutionDownScale();
+  _height = 16 * CoffeeMaker::Renderer::DynamicResolutionDownScale();
+  _speed = SPEED * CoffeeMaker::Renderer::DynamicResolutionDownScale();
+  SetBounds(CoffeeMaker::Renderer::GetOutputWidthF(), CoffeeMaker::Renderer::GetOutputHeightF());
+
+  _x.reserve(MAX_PROJECTILES);
+  _y.reserve(MAX_PROJECTILES);
+  _velocityX.reserve(MAX_PROJECTILES);
+  _velocityY.reserve(MAX_PROJECTILES);
+  _rotation.reserve(MAX_PROJECTILES);
+  _texture.reserve(MAX_PROJECTILES);
+  _alive.reserve(MAX_PROJECTILES);
+  _colliderType.reserve(MAX_PROJECTILES);
+}
+
+void ProjectileSystem::Destroy() {
+  _x.clear();
+  _y.clear();
+  _velocityX.clear();
+  _velocityY.clear();
+  _rotation.clear();
+  _texture.clear();
+  _alive.clear();
+  _colliderType.clear();
+  _textures.fill(nullptr);
+  _fireSound.reset();
+  _impactSound.reset();
+  for (auto& proxy : _proxies) {
+    proxy.reset();
+  }
+}
+
+void ProjectileSystem::SetBounds(float outputWidth, float outputHeight) {
+  _outputWidth = outputWidth;
+  _outputHeight = outputHeight;
+}
+
+bool ProjectileSystem::Fire(Collider::Type colliderType, Type type, Size size, float x, float y, double rotation) {
+  glm::vec2 direction{static_cast<float>(std::cos(glm::radians(rotation))),
+                      static_cast<float>(std::sin(glm::radians(rotation)))};
+  return Spawn(colliderType, type, size, x, y, direction.x, direction.y, rotation + 90);
+}
+
+bool ProjectileSystem::FireAt(Collider::Type colliderType, Type type, Size size, float x, float y, float endX,
+                              float endY, double rotation) {
+  glm::vec2 direction = glm::normalize(glm::vec2{endX - x, endY - y});
+  return Spawn(colliderType, type, size, x, y, direction.x, direction.y, rotation);
+}
+
+bool ProjectileSystem::Spawn(Collider::Type colliderType, Type type, Size size, float x, float y, float directionX,
+                             float directionY, double rotation) {
+  if (_x.size() >= MAX_PROJECTILES) {
+    return false;
+  }
+  _x.push_back(x);
+  _y.push_back(y);
+  _velocityX.push_back(directionX * _speed);
+  _velocityY.push_back(directionY * _speed);
+  _rotation.push_back(static_cast<float>(rotation));
+  _texture.push_back(static_cast<std::uint8_t>(static_cast<int>(type) * 2 + static_cast<int>(size)));
+  _alive.push_back(1);
+  _colliderType.push_back(colliderType);
+  // NOTE: sounds are only loaded by Init, the system also runs without them, ie: in tests
+  if (_fireSound != nullptr) {
+    _fireSound->Play();
+  }
+  return true;
+}
+
+void ProjectileSystem::Update(float deltaTime) {
+  _lastDeltaTime = deltaTime;
+  Integrate(deltaTime);
+  HitTest();
+  Compact();
+}
+
+void ProjectileSystem::Integrate(float deltaTime) {
+  ProjectileBatch::Bounds bounds{.width = _width,
+                                 .height = _height,
+                                 .outputWidth = _outputWidth,
+                                 .outputHeight = _outputHeight};
+  ProjectileBatch::Integrate(_x.data(), _y.data(), _velocityX.data(), _velocityY.data(), _alive.data(), _x.size(),
+                             deltaTime, bounds);
+}
+
+void ProjectileSystem::HitTest() {
+  // NOTE: scratch for this update alone, handed back when the main loop resets the frame arena
+  CoffeeMaker::FrameVector<Collider*> targets{CoffeeMaker::ArenaAllocator<Collider*>(CoffeeMaker::FrameArena::Frame())};
+  Collider::CollectActive(targets);
+  const size_t count = _x.size();
+  for (Collider* target : targets) {
+    const SDL_FRect& rect = target->clientRect;
+    const Collider::Type targetType = target->GetType();
+    for (size_t i = 0; i < count; i++) {
+      if (_alive[i] == 0 || !Collider::CanCollide(_colliderType[i], targetType)) {
+        continue;
+      }
+      if (_x[i] < rect.x + rect.w && _x[i] + _width > rect.x && _y[i] < rect.y + rect.h && _y[i] + _height > rect.y) {
+        _alive[i] = 0;
+        if (_impactSound != nullptr) {
+          _impactSound->Play();
+        }
+        Collider::QueueContact(target, Proxy(_colliderType[i]));
+      }
+    }
+  }
+}
+
+void ProjectileSystem::Compact() {
+  // NOTE: stable, so projectiles keep their draw order
+  const size_t count = _x.size();
+  size_t live = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (_alive[i] != 0) {
+      _x[live] = _x[i];
+      _y[live] = _y[i];
+      _velocityX[live] = _velocityX[i];
+      _velocityY[live] = _velocityY[i];
+      _rotation[live] = _rotation[i];
+      _texture[live] = _texture[i];
+      _alive[live] = 1;
+      _colliderType[live] = _colliderType[i];
+      live++;
+    }
+  }
+  _x.resize(live);
+  _y.resize(live);
+  _velocityX.resize(live);
+  _velocityY.resize(live);
+  _rotation.resize(live);
+  _texture.resize(live);
+  _alive.resize(live);
+  _colliderType.resize(live);
+}
+
+void ProjectileSystem::Render() {
+  const size_t count = _x.size();
+  // NOTE: blends between the last two simulation steps by stepping back along the velocity
+  const float rewind = (CoffeeMaker::FixedTimestep::InterpolationAlpha() - 1.0f) * _lastDeltaTime;
+  for (size_t texture = 0; texture < NUM_TEXTURES; texture++) {
+    if (_textures[texture] == nullptr) {
+      continue;
+    }
+    SDL_Texture* handle = _textures[texture]->Handle();
+    const SDL_Rect& region = _textures[texture]->Region();
+    for (size_t i = 0; i < count; i++) {
+      if (_texture[i] != texture || _alive[i] == 0) {
+        continue;
+      }
+      SDL_FRect clientRect{_x[i] + _velocityX[i] * rewind, _y[i] + _velocityY[i] * rewind, _width, _height};
+      CoffeeMaker::Renderer::DrawSprite(handle, region, clientRect, _rotation[i]);
+    }
+  }
+}
+
+void ProjectileSystem::ReloadAll(Collider::Type colliderType) {
+  const size_t count = _x.size();
+  for (size_t i = 0; i < count; i++) {
+    if (_colliderType[i] == colliderType) {
+      _alive[i] = 0;
+    }
+  }
+  Compact();
+}
+
+size_t ProjectileSystem::Count() { return _x.size(); }
+
+Collider* ProjectileSystem::Proxy(Collider::Type colliderType) {
+  Scope<Collider>& proxy = _proxies[static_cast<size_t>(colliderType)];
+  if (proxy == nullptr) {
+    // NOTE: never active, it only stands in for a projectile when a hit is dispatched
+    proxy = CreateScope<Collider>(colliderType, false);
+    proxy->SetWidth(_width);
+    proxy->SetHeight(_height);
+  }
+  return proxy.get();
+}
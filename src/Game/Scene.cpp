@@ -2,22 +2,34 @@
 
 #include "Event.hpp"
 #include "Game/Enemy.hpp"
+#include "Game/PathFollowerSystem.hpp"
 #include "Game/Player.hpp"
+#include "Game/Systems.hpp"
 #include "Logger.hpp"
 
 int SceneManager::_currentSceneIndex = -1;
 std::vector<Scene*> SceneManager::scenes = {};
 Scene* SceneManager::_currentScene = nullptr;
 
-void SceneManager::UpdateCurrentScene(float deltaTime) { _currentScene->Update(deltaTime); }
+void SceneManager::UpdateCurrentScene(float deltaTime) {
+  // NOTE: ahead of the scene, enemies read where their path took them this frame while they update
+  if (!_currentScene->_paused) {
+    PathFollowerSystem::Update(deltaTime);
+  }
+  _currentScene->Update(deltaTime);
+  UCI::Systems::SyncTransforms(_currentScene->_world);
+  _currentScene->_scheduler.Update(deltaTime);
+}
 
 void SceneManager::PauseScene() {
   _currentScene->Pause();
+  _currentScene->_scheduler.Pause();
   _currentScene->_paused = true;
 }
 
 void SceneManager::UnpauseScene() {
   _currentScene->Unpause();
+  _currentScene->_scheduler.Unpause();
   _currentScene->_paused = false;
 }
 
@@ -29,10 +41,14 @@ bool SceneManager::LoadScene() {
   // NOTE: Handle first scene case
   if (_currentSceneIndex == -1) {
     _currentScene = scenes[++_currentSceneIndex];
+    _currentScene->_scheduler.MakeCurrent();
+    _currentScene->_world.MakeCurrent();
     _currentScene->Init();
     CoffeeMaker::PushCoffeeMakerEvent(CoffeeMaker::ApplicationEvents::COFFEEMAKER_SCENE_LOAD);
   }
   // NOTE: If not the first scene, clean up and then move to next scene
+  // NOTE: scripts go first, they may still point at anything the scene is about to destroy
+  _currentScene->_scheduler.Clear();
   _currentScene->Destroy();
   if (_currentSceneIndex + 1 < (int)scenes.size()) {
     _currentScene = scenes[++_currentSceneIndex];
@@ -41,6 +57,8 @@ bool SceneManager::LoadScene() {
     _currentSceneIndex = 0;
     _currentScene = scenes[_currentSceneIndex];
   }
+  _currentScene->_scheduler.MakeCurrent();
+  _currentScene->_world.MakeCurrent();
   _currentScene->Init();
   CoffeeMaker::PushCoffeeMakerEvent(CoffeeMaker::ApplicationEvents::COFFEEMAKER_SCENE_LOAD);
   return true;
@@ -54,10 +72,13 @@ bool SceneManager::LoadScene(unsigned long index) {
   }
   if (scenes.size() >= index) {
     if (_currentScene != nullptr && _currentScene->IsLoaded()) {
+      _currentScene->_scheduler.Clear();
       _currentScene->Destroy();
     }
     _currentSceneIndex = index;
     _currentScene = scenes[_currentSceneIndex];
+    _currentScene->_scheduler.MakeCurrent();
+    _currentScene->_world.MakeCurrent();
     _currentScene->Init();
     CoffeeMaker::PushCoffeeMakerEvent(CoffeeMaker::ApplicationEvents::COFFEEMAKER_SCENE_LOAD);
   }
@@ -72,10 +93,19 @@ void SceneManager::DestroyAllScenes() {
   }
 }
 
-void SceneManager::DestroyCurrentScene() { _currentScene->Destroy(); }
+void SceneManager::DestroyCurrentScene() {
+  _currentScene->_scheduler.Clear();
+  _currentScene->Destroy();
+}
 
 bool SceneManager::CurrentScenePaused() { return _currentScene->IsPaused(); }
 
+void SceneManager::DispatchUserEvent(const SDL_UserEvent& event) {
+  if (_currentScene != nullptr) {
+    _currentScene->_scheduler.Dispatch(event);
+  }
+}
+
 int Scene::_sceneId = 0;
 
 Scene::Scene() { _id = "Scene-" + std::to_string(++_sceneId); }
@@ -85,3 +115,7 @@ Scene::~Scene() {}
 bool Scene::IsLoaded() { return _loaded; }
 
 bool Scene::IsPaused() { return _paused; }
+
+CoffeeMaker::CoroutineScheduler* Scene::Scheduler() { return &_scheduler; }
+
+CoffeeMaker::ECS::World* Scene::World() { return &_world; }
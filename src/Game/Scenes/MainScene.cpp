@@ -6,8 +6,11 @@
 #include <thread>
 
 #include "Event.hpp"
+#include "EventBus.hpp"
+#include "Game/Animations/EnemyAnimations.hpp"
 #include "Game/Collider.hpp"
 #include "Game/Events.hpp"
+#include "Game/ProjectileSystem.hpp"
 #include "Game/ScoreManager.hpp"
 #include "InputManager.hpp"
 #include "Logger.hpp"
@@ -24,6 +27,8 @@ void MainScene::Render() {
     enemy->Render();
   }
 
+  ProjectileSystem::Render();
+
   _hud->Render();
   _menu->Render();
 }
@@ -77,11 +82,16 @@ void MainScene::Update(float deltaTime) {
     entity->Update(deltaTime);
   }
 
+  ProjectileSystem::Update(deltaTime);
+
   _hud->Update();
 }
 
 void MainScene::Init() {
   CM_LOGGER_DEBUG("============== Initialize Main Scene ==================");
+  // NOTE: the enemy paths load on the ThreadPool while the rest of the scene is set up
+  Animations::EnemyEntrance001::Preload();
+  Animations::EnemyExit001::Preload();
   ScoreManager::ResetScore();
   _music = CoffeeMaker::Audio::LoadMusic("music/AsTheWorldTurns.ogg");
   CoffeeMaker::Audio::PlayMusic(_music);
@@ -93,6 +103,7 @@ void MainScene::Init() {
                                         CoffeeMaker::Renderer::GetOutputHeight(), 75.0f);
   _backgroundSmokeTiles = CreateScope<Tiles>("SpaceSmoke.png", CoffeeMaker::Renderer::GetOutputWidth(),
                                              CoffeeMaker::Renderer::GetOutputHeight(), 100.0f);
+  ProjectileSystem::Init();
   _player = new Player();
   _frontEchelon = new Echelon(363.0f, 50.0f, CoffeeMaker::Renderer::GetOutputWidth(), 15.0f);
   _backEchelon = new Echelon(363.0f, 50.0f, CoffeeMaker::Renderer::GetOutputWidth(), 15.0f);
@@ -115,6 +126,10 @@ void MainScene::Init() {
   }
 
   _entities.push_back(_player);
+  auto handler = [this](const SDL_UserEvent& event) { OnSDLUserEvent(event); };
+  for (Uint32 type : {UCI::Events::ENEMY_INITIAL_INTERVAL_SPAWN, UCI::Events::LOAD_NEW_SCENE}) {
+    _subscriptions.push_back(CoffeeMaker::EventBus::Instance()->Subscribe(type, handler));
+  }
   _loaded = true;
   _enemySpawnTask->Start();
   CM_LOGGER_DEBUG("============== Initialized Main Scene Done ==================");
@@ -122,6 +137,7 @@ void MainScene::Init() {
 
 void MainScene::Destroy() {
   _loaded = false;
+  _subscriptions.clear();
   _enemySpawnTask->Cancel();
   CoffeeMaker::Audio::StopMusic();
   CoffeeMaker::Audio::FreeMusic(_music);
@@ -133,6 +149,7 @@ void MainScene::Destroy() {
   delete _frontEchelon;
   delete _backEchelon;
   _enemies.fill(nullptr);
+  ProjectileSystem::Destroy();
   Collider::ClearAllUnprocessedCollisions();
   _backgroundTiles.reset();
   _backgroundSmokeTiles.reset();
@@ -144,13 +161,13 @@ void MainScene::Destroy() {
 
 MainScene::MainScene() :
     _enemySpawnTask(CreateScope<CoffeeMaker::Async::IntervalTask>(
-        [] { CoffeeMaker::PushUserEvent(UCI::Events::ENEMY_INITIAL_INTERVAL_SPAWN); }, 300)) {}
+        [] { CoffeeMaker::PublishEvent(UCI::Events::ENEMY_INITIAL_INTERVAL_SPAWN); }, 300)) {}
 
 void MainScene::OnSDLUserEvent(const SDL_UserEvent& event) {
   if (_loaded) {
     switch (event.type) {
       case UCI::Events::ENEMY_INITIAL_INTERVAL_SPAWN: {
-        CoffeeMaker::PushUserEvent(UCI::Events::ENEMY_SPAWNED, -1, _enemies[_currentSpawn++]);
+        CoffeeMaker::PublishEvent(UCI::Events::ENEMY_SPAWNED, -1, _enemies[_currentSpawn++]);
         if (_currentSpawn == MAX_ENEMIES) {
           _enemySpawnTask->Cancel();
         }
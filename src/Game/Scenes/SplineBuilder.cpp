@@ -25,6 +25,7 @@ void SplineBuilder::Render() {
     v->Render();
   }
 
+  CoffeeMaker::Renderer::Flush();
   SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), 255, 255, 255, 255);
   for (auto& curvePoint : _bSplineCurvePoints) {
     SDL_FRect s = SDL_FRect{.x = curvePoint.x, .y = curvePoint.y, .w = 1, .h = 1};
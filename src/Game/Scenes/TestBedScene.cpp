@@ -93,6 +93,7 @@ void TestEnemy::Update(float deltaTime) {
 void TestEnemy::Render() {
   // Render enemy sprite
   _sprite->Render();
+  CoffeeMaker::Renderer::Flush();
   SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), CoffeeMaker::Colors::Yellow.r,
                          CoffeeMaker::Colors::Yellow.g, CoffeeMaker::Colors::Yellow.b, CoffeeMaker::Colors::Yellow.a);
   SDL_RenderDrawLineF(CoffeeMaker::Renderer::Instance(), _position.x, _position.y, TestPlayer::Position().x,
@@ -154,6 +155,7 @@ void TestPlayer::Render() {
   //                        CoffeeMaker::Colors::Blue.b, CoffeeMaker::Colors::Blue.a);
   // SDL_RenderDrawLineF(CoffeeMaker::Renderer::Instance(), 800, 300, _randLookAt.x, _randLookAt.y);
   // SDL_RenderDrawLineF(CoffeeMaker::Renderer::Instance(), _position.x, _position.y, 800, 300);
+  CoffeeMaker::Renderer::Flush();
   SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), CoffeeMaker::Colors::Red.r, CoffeeMaker::Colors::Red.g,
                          CoffeeMaker::Colors::Red.b, CoffeeMaker::Colors::Red.a);
   SDL_RenderDrawLineF(CoffeeMaker::Renderer::Instance(), 400, 0, 400, 600);
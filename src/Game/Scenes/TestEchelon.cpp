@@ -3,6 +3,7 @@
 #include <thread>
 
 #include "Game/Events.hpp"
+#include "Game/ProjectileSystem.hpp"
 #include "InputManager.hpp"
 
 TestEchelonScene::TestEchelonScene() :
@@ -33,6 +34,7 @@ void TestEchelonScene::Render() {
     e->Render();
   }
   _player->Render();
+  ProjectileSystem::Render();
 }
 
 void TestEchelonScene::Update(float deltaTime) {
@@ -99,9 +101,11 @@ void TestEchelonScene::Update(float deltaTime) {
   }
 
   _player->Update(deltaTime);
+  ProjectileSystem::Update(deltaTime);
 }
 
 void TestEchelonScene::Init() {
+  ProjectileSystem::Init();
   for (int i = 0; i < 5; i++) {
     EchelonEnemy* e = new EchelonEnemy();
     e->SetAggressionState(Enemy::AggressionState::Active);
@@ -130,6 +134,7 @@ void TestEchelonScene::Destroy() {
     delete e;
   }
   _enemies.clear();
+  ProjectileSystem::Destroy();
   Collider::ClearAllUnprocessedCollisions();
 }
 
@@ -15,7 +15,9 @@ unsigned int ScoreManager::_incrementAmount = 10;
 ScoreManager::ScoreManager() :
     _score(0),
     _highScores(HighScores{.firstPlace = 0, .secondPlace = 0, .thirdPlace = 0}),
-    _scoreFile(CoffeeMaker::File{.name = "scores.txt", .loaded = false, .data = nullptr}) {}
+    _scoreFile(CoffeeMaker::File{.name = "scores.txt", .loaded = false, .data = nullptr}),
+    _incrementScore(CoffeeMaker::EventBus::Instance()->Subscribe(
+        UCI::Events::PLAYER_INCREMENT_SCORE, [this](const SDL_UserEvent& event) { OnSDLUserEvent(event); })) {}
 
 ScoreManager::~ScoreManager() { _instance = nullptr; }
 
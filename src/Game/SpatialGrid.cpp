@@ -0,0 +1,97 @@
+#include "Game/SpatialGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellSize) :
+    _cellSize(cellSize),
+    _cellWidth(cellSize),
+    _cellHeight(cellSize),
+    _originX(0),
+    _originY(0),
+    _columns(0),
+    _rows(0),
+    _rects(nullptr),
+    _layers(nullptr),
+    _masks(nullptr) {}
+
+void SpatialGrid::Build(const SDL_FRect* rects, size_t count, const std::uint32_t* layers,
+                        const std::uint32_t* masks) {
+  _rects = rects;
+  _layers = layers;
+  _masks = masks;
+  _cellEntries.clear();
+  if (count == 0) {
+    _columns = 0;
+    _rows = 0;
+    _cellStart.assign(1, 0);
+    return;
+  }
+
+  float minX = rects[0].x;
+  float minY = rects[0].y;
+  float maxX = rects[0].x + rects[0].w;
+  float maxY = rects[0].y + rects[0].h;
+  for (size_t i = 1; i < count; i++) {
+    minX = std::min(minX, rects[i].x);
+    minY = std::min(minY, rects[i].y);
+    maxX = std::max(maxX, rects[i].x + rects[i].w);
+    maxY = std::max(maxY, rects[i].y + rects[i].h);
+  }
+
+  _originX = minX;
+  _originY = minY;
+  _cellWidth = std::max(_cellSize, (maxX - minX) / MAX_CELLS_PER_AXIS);
+  _cellHeight = std::max(_cellSize, (maxY - minY) / MAX_CELLS_PER_AXIS);
+  _columns = std::min(MAX_CELLS_PER_AXIS, static_cast<int>((maxX - minX) / _cellWidth) + 1);
+  _rows = std::min(MAX_CELLS_PER_AXIS, static_cast<int>((maxY - minY) / _cellHeight) + 1);
+
+  // NOTE: counting sort, the first pass sizes every cell and the second pass fills them in place.
+  _cellStart.assign(static_cast<size_t>(_columns * _rows) + 1, 0);
+  for (size_t i = 0; i < count; i++) {
+    int c0 = Column(rects[i].x);
+    int c1 = Column(rects[i].x + rects[i].w);
+    int r0 = Row(rects[i].y);
+    int r1 = Row(rects[i].y + rects[i].h);
+    for (int r = r0; r <= r1; r++) {
+      for (int c = c0; c <= c1; c++) {
+        _cellStart[CellIndex(c, r) + 1]++;
+      }
+    }
+  }
+  for (size_t cell = 1; cell < _cellStart.size(); cell++) {
+    _cellStart[cell] += _cellStart[cell - 1];
+  }
+
+  _cellEntries.resize(_cellStart.back());
+  for (size_t i = 0; i < count; i++) {
+    int c0 = Column(rects[i].x);
+    int c1 = Column(rects[i].x + rects[i].w);
+    int r0 = Row(rects[i].y);
+    int r1 = Row(rects[i].y + rects[i].h);
+    for (int r = r0; r <= r1; r++) {
+      for (int c = c0; c <= c1; c++) {
+        // NOTE: borrow the start offsets as write cursors, they are shifted back into place below.
+        _cellEntries[_cellStart[CellIndex(c, r)]++] = static_cast<std::uint32_t>(i);
+      }
+    }
+  }
+  for (size_t cell = _cellStart.size() - 1; cell > 0; cell--) {
+    _cellStart[cell] = _cellStart[cell - 1];
+  }
+  _cellStart[0] = 0;
+}
+
+int SpatialGrid::Column(float x) const {
+  int column = static_cast<int>(std::floor((x - _originX) / _cellWidth));
+  return std::clamp(column, 0, _columns - 1);
+}
+
+int SpatialGrid::Row(float y) const {
+  int row = static_cast<int>(std::floor((y - _originY) / _cellHeight));
+  return std::clamp(row, 0, _rows - 1);
+}
+
+int SpatialGrid::Columns() const { return _columns; }
+
+int SpatialGrid::Rows() const { return _rows; }
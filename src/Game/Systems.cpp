@@ -0,0 +1,19 @@
+#include "Game/Systems.hpp"
+
+#include "Game/Components.hpp"
+
+void UCI::Systems::SyncTransforms(CoffeeMaker::ECS::World& world) {
+  using namespace UCI::Components;
+
+  world.Each<Transform, Sprite>([](CoffeeMaker::ECS::Handle, Transform& transform, Sprite& sprite) {
+    sprite.sprite->rotation = transform.rotation;
+    sprite.sprite->SetPosition(transform.position);
+  });
+  world.Each<Transform, Body>([](CoffeeMaker::ECS::Handle, Transform& transform, Body& body) {
+    // NOTE: only the position is taken, the collider keeps its own size
+    body.collider->Update(SDL_FRect{.x = transform.position.x,
+                                    .y = transform.position.y,
+                                    .w = body.collider->clientRect.w,
+                                    .h = body.collider->clientRect.h});
+  });
+}
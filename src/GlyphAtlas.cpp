@@ -0,0 +1,192 @@
+#include "GlyphAtlas.hpp"
+
+#include <algorithm>
+
+#include "Logger.hpp"
+#include "MessageBox.hpp"
+#include "Renderer.hpp"
+
+using namespace CoffeeMaker;
+
+std::unordered_map<TTF_Font*, GlyphAtlas::Cache> GlyphAtlas::_caches = {};
+std::vector<GlyphAtlas::Line> GlyphAtlas::_lines = {};
+size_t GlyphAtlas::_rasterized = 0;
+
+void GlyphAtlas::BreakLines(const std::string& text, const int* advances, int wrapLength, std::vector<Line>& lines) {
+  lines.clear();
+  size_t begin = 0;
+  int width = 0;
+  // NOTE: the last space on the current line, and the width of the line up to it
+  size_t space = std::string::npos;
+  int spaceWidth = 0;
+  for (size_t i = 0; i < text.size(); i++) {
+    const unsigned char byte = static_cast<unsigned char>(text[i]);
+    if (byte == '\n') {
+      lines.push_back(Line{.begin = begin, .end = i, .width = width});
+      begin = i + 1;
+      width = 0;
+      space = std::string::npos;
+      continue;
+    }
+    const int advance = advances[byte];
+    if (wrapLength > 0 && i > begin && width + advance > wrapLength) {
+      if (byte == ' ') {
+        lines.push_back(Line{.begin = begin, .end = i, .width = width});
+        begin = i + 1;
+        width = 0;
+        space = std::string::npos;
+        continue;
+      }
+      if (space != std::string::npos) {
+        lines.push_back(Line{.begin = begin, .end = space, .width = spaceWidth});
+        width -= spaceWidth + advances[static_cast<unsigned char>(' ')];
+        begin = space + 1;
+        space = std::string::npos;
+      } else {
+        lines.push_back(Line{.begin = begin, .end = i, .width = width});
+        begin = i;
+        width = 0;
+      }
+    }
+    if (byte == ' ') {
+      space = i;
+      spaceWidth = width;
+    }
+    width += advance;
+  }
+  lines.push_back(Line{.begin = begin, .end = text.size(), .width = width});
+}
+
+SDL_Point GlyphAtlas::Layout(TTF_Font* font, const std::string& text, Uint32 wrapLength,
+                             std::vector<PlacedGlyph>& glyphs) {
+  glyphs.clear();
+  if (text.empty()) {
+    return SDL_Point{0, 0};
+  }
+  Cache& cache = Use(font);
+  BreakLines(text, cache.advances.data(), static_cast<int>(wrapLength), _lines);
+
+  int width = 0;
+  int y = 0;
+  for (const Line& line : _lines) {
+    int x = 0;
+    width = std::max(width, line.width);
+    for (size_t i = line.begin; i < line.end; i++) {
+      const unsigned char byte = static_cast<unsigned char>(text[i]);
+      const Glyph& glyph = cache.glyphs[byte].rasterized ? cache.glyphs[byte] : Rasterize(cache, font, byte);
+      if (glyph.rect.w > 0) {
+        glyphs.push_back(PlacedGlyph{.texture = cache.pages[glyph.page]->handle,
+                                     .source = glyph.rect,
+                                     .destination = SDL_FRect{static_cast<float>(x), static_cast<float>(y),
+                                                              static_cast<float>(glyph.rect.w),
+                                                              static_cast<float>(glyph.rect.h)}});
+        // NOTE: a glyph may reach past its advance, ie: italics
+        width = std::max(width, x + glyph.rect.w);
+      }
+      x += cache.advances[byte];
+    }
+    y += cache.lineSkip;
+  }
+  const int height = static_cast<int>(_lines.size() - 1) * cache.lineSkip + cache.height;
+  return SDL_Point{width, height};
+}
+
+void GlyphAtlas::Destroy() {
+  _caches.clear();
+  _lines.clear();
+}
+
+size_t GlyphAtlas::NumFonts() { return _caches.size(); }
+
+size_t GlyphAtlas::Rasterized() { return _rasterized; }
+
+GlyphAtlas::Cache& GlyphAtlas::Use(TTF_Font* font) {
+  auto search = _caches.find(font);
+  if (search != _caches.end()) {
+    return search->second;
+  }
+
+  Cache& cache = _caches[font];
+  cache.lineSkip = TTF_FontLineSkip(font);
+  cache.height = TTF_FontHeight(font);
+  cache.x = 0;
+  cache.y = 0;
+  cache.shelf = 0;
+  for (size_t i = 0; i < cache.glyphs.size(); i++) {
+    cache.glyphs[i] = Glyph{.rasterized = false, .page = 0, .rect = SDL_Rect{0, 0, 0, 0}};
+    // NOTE: metrics only, nothing is rasterized
+    int advance = 0;
+    if (TTF_GlyphMetrics(font, static_cast<Uint16>(i), nullptr, nullptr, nullptr, nullptr, &advance) != 0) {
+      advance = 0;
+    }
+    cache.advances[i] = advance;
+  }
+  for (int byte = FIRST_PRELOADED; byte <= LAST_PRELOADED; byte++) {
+    Rasterize(cache, font, static_cast<unsigned char>(byte));
+  }
+  CM_LOGGER_INFO("[GlyphAtlas] Preloaded glyphs {} to {} onto {} page(s)", static_cast<int>(FIRST_PRELOADED),
+                 static_cast<int>(LAST_PRELOADED), cache.pages.size());
+  return cache;
+}
+
+const GlyphAtlas::Glyph& GlyphAtlas::Rasterize(Cache& cache, TTF_Font* font, unsigned char byte) {
+  Glyph& glyph = cache.glyphs[byte];
+  glyph.rasterized = true;
+
+  SDL_Surface* surface = TTF_RenderGlyph_Blended(font, byte, SDL_Color{255, 255, 255, 255});
+  if (surface == nullptr) {
+    // NOTE: the font has no glyph for it, it is laid out as blank space
+    return glyph;
+  }
+  if (surface->format->format != SDL_PIXELFORMAT_ARGB8888) {
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+    SDL_FreeSurface(surface);
+    surface = converted;
+    if (surface == nullptr) {
+      return glyph;
+    }
+  }
+  const int width = surface->w + PADDING * 2;
+  const int height = surface->h + PADDING * 2;
+  if (surface->w == 0 || surface->h == 0 || width > PAGE_SIZE || height > PAGE_SIZE) {
+    if (width > PAGE_SIZE || height > PAGE_SIZE) {
+      CM_LOGGER_WARN("[GlyphAtlas] Glyph {} is too large for a {}px page", static_cast<int>(byte), PAGE_SIZE);
+    }
+    SDL_FreeSurface(surface);
+    return glyph;
+  }
+
+  if (!cache.pages.empty() && cache.x + width > PAGE_SIZE) {
+    cache.x = 0;
+    cache.y += cache.shelf;
+    cache.shelf = 0;
+  }
+  if (cache.pages.empty() || cache.y + height > PAGE_SIZE) {
+    AddPage(cache);
+  }
+
+  glyph.page = cache.pages.size() - 1;
+  glyph.rect = SDL_Rect{cache.x + PADDING, cache.y + PADDING, surface->w, surface->h};
+  SDL_UpdateTexture(cache.pages[glyph.page]->handle, &glyph.rect, surface->pixels, surface->pitch);
+  SDL_FreeSurface(surface);
+  cache.x += width;
+  cache.shelf = std::max(cache.shelf, height);
+  _rasterized++;
+  return glyph;
+}
+
+void GlyphAtlas::AddPage(Cache& cache) {
+  SDL_Texture* texture = SDL_CreateTexture(Renderer::Instance(), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+                                           PAGE_SIZE, PAGE_SIZE);
+  if (texture == nullptr) {
+    MessageBox::ShowMessageBoxAndQuit("Glyph Atlas Error", "Could not create a glyph atlas page");
+  }
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  // NOTE: the padding between glyphs is never written to, start from a transparent page
+  const std::vector<Uint32> transparent(static_cast<size_t>(PAGE_SIZE * PAGE_SIZE), 0);
+  SDL_UpdateTexture(texture, nullptr, transparent.data(), PAGE_SIZE * static_cast<int>(sizeof(Uint32)));
+  cache.pages.push_back(TextureRegistry::Adopt(texture, PAGE_SIZE, PAGE_SIZE));
+  cache.x = 0;
+  cache.y = 0;
+  cache.shelf = 0;
+}
@@ -0,0 +1,35 @@
+#include "Memory.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+  // NOTE: constant initialized, so allocations made by other static initializers are counted too
+  std::atomic<std::uint64_t> allocations{0};
+  std::uint64_t frameStart = 0;
+  std::uint64_t lastFrame = 0;
+}  // namespace
+
+std::uint64_t CoffeeMaker::Memory::Allocations() { return allocations.load(std::memory_order_relaxed); }
+
+void CoffeeMaker::Memory::EndFrame() {
+  const std::uint64_t now = Allocations();
+  lastFrame = now - frameStart;
+  frameStart = now;
+}
+
+std::uint64_t CoffeeMaker::Memory::LastFrameAllocations() { return lastFrame; }
+
+void* operator new(std::size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  void* memory = std::malloc(size == 0 ? 1 : size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
@@ -24,6 +24,7 @@ Line::~Line() {}
 
 void Line::Render()
 {
+  CoffeeMaker::Renderer::Flush();
   SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), color.r, color.g, color.b, color.a);
   SDL_RenderDrawLine(CoffeeMaker::Renderer::Instance(), left, top, endX, endY);
 }
@@ -37,6 +37,7 @@ int Rect::Left()
 
 void Rect::Render()
 {
+  CoffeeMaker::Renderer::Flush();
   SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), color.r, color.g, color.b, color.a);
   SDL_RenderFillRect(CoffeeMaker::Renderer::Instance(), &clientRect);
 }
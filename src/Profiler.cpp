@@ -0,0 +1,203 @@
+#include "Profiler.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+#include "Logger.hpp"
+
+using namespace CoffeeMaker;
+
+namespace {
+  const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+  thread_local ProfileBuffer* threadBuffer = nullptr;
+  thread_local std::uint32_t threadDepth = 0;
+
+  std::string Escape(const char* name) {
+    std::string escaped;
+    for (const char* c = name; *c != '\0'; c++) {
+      if (*c == '"' || *c == '\\') {
+        escaped += '\\';
+      }
+      escaped += *c;
+    }
+    return escaped;
+  }
+}  // namespace
+
+std::mutex Profiler::_buffersMutex;
+std::vector<std::unique_ptr<ProfileBuffer>> Profiler::_buffers = {};
+std::vector<ZoneStats> Profiler::_lastFrame = {};
+std::uint64_t Profiler::_frameStart = 0;
+std::uint64_t Profiler::_lastFrameNs = 0;
+std::uint64_t Profiler::_frameCount = 0;
+std::uint64_t Profiler::_spikeThresholdNs = 0;
+bool Profiler::_capturing = false;
+size_t Profiler::_maxCaptureEvents = 0;
+std::vector<ProfileEvent> Profiler::_capture = {};
+
+ProfileBuffer::ProfileBuffer(std::uint32_t thread) : _events{}, _thread(thread), _head(0), _tail(0), _dropped(0) {}
+
+bool ProfileBuffer::Push(const ProfileEvent& event) {
+  const size_t head = _head.load(std::memory_order_relaxed);
+  if (head - _tail.load(std::memory_order_acquire) == CAPACITY) {
+    _dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  _events[head & (CAPACITY - 1)] = event;
+  _head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+std::uint32_t ProfileBuffer::Thread() const { return _thread; }
+
+std::uint64_t ProfileBuffer::Dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+std::uint64_t Profiler::Now() {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+ProfileBuffer* Profiler::ThreadBuffer() {
+  if (threadBuffer == nullptr) {
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    _buffers.push_back(std::make_unique<ProfileBuffer>(static_cast<std::uint32_t>(_buffers.size())));
+    threadBuffer = _buffers.back().get();
+  }
+  return threadBuffer;
+}
+
+void Profiler::EndFrame() {
+  const std::uint64_t now = Now();
+  _lastFrame.clear();
+  {
+    // NOTE: only held long enough to stop a new thread from growing the list while it is walked
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    for (auto& buffer : _buffers) {
+      buffer->Drain([](const ProfileEvent& event) {
+        Aggregate(event);
+        if (_capturing && _capture.size() < _maxCaptureEvents) {
+          _capture.push_back(event);
+        }
+      });
+    }
+  }
+  if (_capturing && _capture.size() < _maxCaptureEvents && _frameCount > 0) {
+    _capture.push_back(ProfileEvent{
+        .name = "Frame", .start = _frameStart, .end = now, .depth = 0, .thread = ThreadBuffer()->Thread()});
+  }
+
+  _lastFrameNs = _frameCount > 0 ? now - _frameStart : 0;
+  _frameStart = now;
+  _frameCount++;
+  if (_spikeThresholdNs > 0 && _lastFrameNs > _spikeThresholdNs) {
+    LogFrame();
+  }
+}
+
+const std::vector<ZoneStats>& Profiler::LastFrame() { return _lastFrame; }
+
+std::uint64_t Profiler::LastFrameNs() { return _lastFrameNs; }
+
+std::uint64_t Profiler::FrameCount() { return _frameCount; }
+
+void Profiler::SetSpikeThreshold(double milliseconds) {
+  _spikeThresholdNs = static_cast<std::uint64_t>(std::max(milliseconds, 0.0) * 1000000.0);
+}
+
+std::uint64_t Profiler::Dropped() {
+  std::lock_guard<std::mutex> lock(_buffersMutex);
+  std::uint64_t dropped = 0;
+  for (auto& buffer : _buffers) {
+    dropped += buffer->Dropped();
+  }
+  return dropped;
+}
+
+void Profiler::StartCapture(size_t maxEvents) {
+  _capture.clear();
+  _capture.reserve(std::min(maxEvents, DEFAULT_CAPTURE_EVENTS));
+  _maxCaptureEvents = maxEvents;
+  _capturing = true;
+}
+
+void Profiler::StopCapture() { _capturing = false; }
+
+bool Profiler::Capturing() { return _capturing; }
+
+size_t Profiler::NumCapturedEvents() { return _capture.size(); }
+
+std::string Profiler::ChromeTrace() {
+  std::string trace = "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+  for (size_t i = 0; i < _capture.size(); i++) {
+    const ProfileEvent& event = _capture[i];
+    trace += fmt::format(
+        fmt::runtime(R"(  {{"name": "{}", "ph": "X", "pid": 0, "tid": {}, "ts": {:.3f}, "dur": {:.3f}}}{})"),
+        Escape(event.name), event.thread, event.start / 1000.0, (event.end - event.start) / 1000.0,
+        i + 1 < _capture.size() ? ",\n" : "\n");
+  }
+  trace += "]}\n";
+  return trace;
+}
+
+bool Profiler::WriteChromeTrace(const std::string& filePath) {
+  std::ofstream file(filePath);
+  if (!file) {
+    CM_LOGGER_ERROR("[Profiler] Could not write trace to {}", filePath);
+    return false;
+  }
+  file << ChromeTrace();
+  return true;
+}
+
+void Profiler::Reset() {
+  std::lock_guard<std::mutex> lock(_buffersMutex);
+  for (auto& buffer : _buffers) {
+    buffer->Drain([](const ProfileEvent&) {});
+  }
+  _lastFrame.clear();
+  _frameStart = 0;
+  _lastFrameNs = 0;
+  _frameCount = 0;
+  _capturing = false;
+  _capture.clear();
+}
+
+void Profiler::Aggregate(const ProfileEvent& event) {
+  const std::uint64_t duration = event.end - event.start;
+  // NOTE: zones are keyed by the address of their name, there are only ever a handful per frame
+  auto zone = std::find_if(_lastFrame.begin(), _lastFrame.end(), [&event](const ZoneStats& stats) {
+    return stats.name == event.name && stats.depth == event.depth;
+  });
+  if (zone == _lastFrame.end()) {
+    _lastFrame.push_back(ZoneStats{
+        .name = event.name, .depth = event.depth, .first = event.start, .calls = 0, .totalNs = 0, .maxNs = 0});
+    zone = _lastFrame.end() - 1;
+  }
+  zone->first = std::min(zone->first, event.start);
+  zone->calls++;
+  zone->totalNs += duration;
+  zone->maxNs = std::max(zone->maxNs, duration);
+}
+
+void Profiler::LogFrame() {
+  CM_LOGGER_WARN("[Profiler] Frame {} took {:.3f} ms", _frameCount - 1, _lastFrameNs / 1000000.0);
+  // NOTE: zones close inside out, listing them by when they opened puts parents above their children
+  std::vector<ZoneStats> zones = _lastFrame;
+  std::sort(zones.begin(), zones.end(), [](const ZoneStats& a, const ZoneStats& b) { return a.first < b.first; });
+  for (const ZoneStats& zone : zones) {
+    CM_LOGGER_WARN("[Profiler] {:>{}}{}: {:.3f} ms over {} call(s)", "", zone.depth * 2, zone.name,
+                   zone.totalNs / 1000000.0, zone.calls);
+  }
+}
+
+ProfileZone::ProfileZone(const char* name) : _name(name), _start(Profiler::Now()), _depth(threadDepth++) {}
+
+ProfileZone::~ProfileZone() {
+  threadDepth--;
+  ProfileBuffer* buffer = Profiler::ThreadBuffer();
+  buffer->Push(ProfileEvent{
+      .name = _name, .start = _start, .end = Profiler::Now(), .depth = _depth, .thread = buffer->Thread()});
+}
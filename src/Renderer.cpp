@@ -1,5 +1,8 @@
 #include "Renderer.hpp"
 
+#include <cmath>
+#include <utility>
+
 #include "Logger.hpp"
 #include "Window.hpp"
 
@@ -11,11 +14,17 @@ Uint32 Renderer::_numDrawCalls = 0;
 int Renderer::_width = 0;
 int Renderer::_height = 0;
 SDL_BlendMode Renderer::_blendMode = SDL_BLENDMODE_NONE;
-
-Renderer::Renderer() {
+Uint32 Renderer::_numVertices = 0;
+Uint32 Renderer::_numSprites = 0;
+std::vector<SDL_Vertex> Renderer::_vertices = {};
+std::vector<int> Renderer::_indices = {};
+SDL_Texture *Renderer::_batchTexture = nullptr;
+float Renderer::_batchTextureWidth = 1.0f;
+float Renderer::_batchTextureHeight = 1.0f;
+
+Renderer::Renderer(Uint32 flags) {
   if (_renderer == nullptr) {
-    _renderer = SDL_CreateRenderer(GlobalWindow::Instance()->Handle(), -1,
-                                   SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    _renderer = SDL_CreateRenderer(GlobalWindow::Instance()->Handle(), -1, flags);
     SDL_GetRendererOutputSize(_renderer, &_width, &_height);
     SDL_Rect vp;
     SDL_RenderGetViewport(Renderer::Instance(), &vp);
@@ -35,13 +44,21 @@ SDL_Renderer *Renderer::Instance() { return _renderer; }
 
 void Renderer::BeginRender() {
   _numDrawCalls = 0;
+  _numVertices = 0;
+  _numSprites = 0;
   SDL_SetRenderDrawColor(_renderer, 255, 255, 255, 255);
   SDL_RenderClear(_renderer);
 }
 
-void Renderer::EndRender() { SDL_RenderPresent(_renderer); }
+void Renderer::EndRender() {
+  Flush();
+  SDL_RenderPresent(_renderer);
+}
 
 void Renderer::Destroy() {
+  _vertices.clear();
+  _indices.clear();
+  _batchTexture = nullptr;
   SDL_DestroyRenderer(_renderer);
   _renderer = nullptr;
 }
@@ -50,6 +67,76 @@ Uint32 Renderer::DrawCalls() { return _numDrawCalls; }
 
 void Renderer::IncDrawCalls() { _numDrawCalls++; }
 
+Uint32 Renderer::Vertices() { return _numVertices; }
+
+Uint32 Renderer::Sprites() { return _numSprites; }
+
+void Renderer::DrawSprite(SDL_Texture *texture, const SDL_Rect &source, const SDL_FRect &destination,
+                          double rotation, SDL_RendererFlip flip, const SDL_Color &color) {
+  if (texture != _batchTexture) {
+    Flush();
+    int width = 1;
+    int height = 1;
+    SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+    _batchTexture = texture;
+    _batchTextureWidth = static_cast<float>(width);
+    _batchTextureHeight = static_cast<float>(height);
+  }
+
+  float u0 = source.x / _batchTextureWidth;
+  float v0 = source.y / _batchTextureHeight;
+  float u1 = (source.x + source.w) / _batchTextureWidth;
+  float v1 = (source.y + source.h) / _batchTextureHeight;
+  if ((flip & SDL_FLIP_HORIZONTAL) != 0) {
+    std::swap(u0, u1);
+  }
+  if ((flip & SDL_FLIP_VERTICAL) != 0) {
+    std::swap(v0, v1);
+  }
+
+  // NOTE: same convention as SDL_RenderCopyEx, clockwise in screen space around the center of the destination
+  float cosine = 1.0f;
+  float sine = 0.0f;
+  if (rotation != 0.0) {
+    double radians = rotation * M_PI / 180.0;
+    cosine = static_cast<float>(std::cos(radians));
+    sine = static_cast<float>(std::sin(radians));
+  }
+  const float halfWidth = destination.w * 0.5f;
+  const float halfHeight = destination.h * 0.5f;
+  const float centerX = destination.x + halfWidth;
+  const float centerY = destination.y + halfHeight;
+  const float corners[4][4] = {{-halfWidth, -halfHeight, u0, v0},
+                               {halfWidth, -halfHeight, u1, v0},
+                               {halfWidth, halfHeight, u1, v1},
+                               {-halfWidth, halfHeight, u0, v1}};
+
+  const int first = static_cast<int>(_vertices.size());
+  for (const auto &corner : corners) {
+    SDL_FPoint position{centerX + corner[0] * cosine - corner[1] * sine,
+                        centerY + corner[0] * sine + corner[1] * cosine};
+    _vertices.push_back(SDL_Vertex{position, color, SDL_FPoint{corner[2], corner[3]}});
+  }
+  _indices.insert(_indices.end(), {first, first + 1, first + 2, first, first + 2, first + 3});
+  _numSprites++;
+}
+
+const std::vector<SDL_Vertex> &Renderer::QueuedVertices() { return _vertices; }
+
+void Renderer::Flush() {
+  if (_indices.empty()) {
+    return;
+  }
+  SDL_RenderGeometry(_renderer, _batchTexture, _vertices.data(), static_cast<int>(_vertices.size()), _indices.data(),
+                     static_cast<int>(_indices.size()));
+  _numDrawCalls++;
+  _numVertices += static_cast<Uint32>(_vertices.size());
+  _vertices.clear();
+  _indices.clear();
+  // NOTE: forget the texture, the next batch may be for a new texture at the same address
+  _batchTexture = nullptr;
+}
+
 bool Renderer::Exists() { return _renderer != nullptr; }
 
 int Renderer::GetOutputWidth() { return _width; }
@@ -2,16 +2,30 @@
 
 #include <SDL2/SDL.h>
 
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <utility>
 
 #include "Color.hpp"
+#include "File.hpp"
+#include "Logger.hpp"
 #include "MessageBox.hpp"
 #include "Renderer.hpp"
 #include "Utilities.hpp"
 
 CoffeeMaker::BSpline::BSpline(size_t numControlPoints) :
-    _cache({}), _tinysplineBSpline(CreateScope<tinyspline::BSpline>(numControlPoints)), _curves({}) {
+    _cache({}),
+    _tinysplineBSpline(CreateScope<tinyspline::BSpline>(numControlPoints)),
+    _curves({}),
+    _evalKnots({}),
+    _evalPoints({}),
+    _evalDegree(0),
+    _evalDirty(true),
+    _arc(),
+    _arcDirty(true) {
   for (size_t i = 0; i < numControlPoints; i++) {
     _tinysplineBSpline->setControlPointAt(i, std::vector<tinyspline::real>{0, 0});
   }
@@ -21,26 +35,32 @@ CoffeeMaker::BSpline::~BSpline() = default;
 
 void CoffeeMaker::BSpline::Load(const std::string& filePath) {
   std::string fullFilePath = CoffeeMaker::Utilities::AssetsDirectory() + "/" + filePath;
-  std::ifstream inf{fullFilePath};
-  if (!inf) {
+  std::vector<tinyspline::real> pointsFromFile = {};
+  if (!ReadControlPoints(fullFilePath, pointsFromFile)) {
     CoffeeMaker::MessageBox::ShowMessageBoxAndQuit("Error Reading File",
                                                    "Could not read file: \"" + fullFilePath + "\"");
+    return;
   }
 
-  std::vector<tinyspline::real> pointsFromFile = {};
   _cache.clear();
   _curves.clear();
+  _tinysplineBSpline = CreateScope<tinyspline::BSpline>(pointsFromFile.size() / 2);
+  SetControlPoints(pointsFromFile);
+}
 
+bool CoffeeMaker::BSpline::ReadControlPoints(const std::string& fullFilePath, std::vector<tinyspline::real>& points) {
+  std::ifstream inf{fullFilePath};
+  if (!inf) {
+    return false;
+  }
   while (inf) {
     std::string input;
     inf >> input;
     if (input != "") {
-      pointsFromFile.push_back(std::stod(input));
+      points.push_back(std::stod(input));
     }
   }
-
-  _tinysplineBSpline = CreateScope<tinyspline::BSpline>(pointsFromFile.size() / 2);
-  SetControlPoints(pointsFromFile);
+  return points.size() >= 2;
 }
 
 void CoffeeMaker::BSpline::Save() const { _tinysplineBSpline->save("tmp.spline"); }
@@ -83,6 +103,7 @@ void CoffeeMaker::BSpline::RemoveControlPointAt(size_t) {
 
 void CoffeeMaker::BSpline::SetControlPoints(const std::vector<tinyspline::real>& controlPoints) {
   _tinysplineBSpline->setControlPoints(controlPoints);
+  _evalDirty = true;
 }
 
 void CoffeeMaker::BSpline::SetControlPoints(const std::vector<CoffeeMaker::Math::Point2D>& controlPoints) {
@@ -101,12 +122,14 @@ void CoffeeMaker::BSpline::SetControlPointAt(size_t index, const CoffeeMaker::Ma
   std::vector<tinyspline::real> pointToAdd{static_cast<tinyspline::real>(vector.x),
                                            static_cast<tinyspline::real>(vector.y)};
   _tinysplineBSpline->setControlPointAt(index, pointToAdd);
+  _evalDirty = true;
 }
 
 void CoffeeMaker::BSpline::SetControlPointAt(size_t index, const CoffeeMaker::Math::Point2D& point) {
   std::vector<tinyspline::real> pointToAdd{static_cast<tinyspline::real>(point.x),
                                            static_cast<tinyspline::real>(point.y)};
   _tinysplineBSpline->setControlPointAt(index, pointToAdd);
+  _evalDirty = true;
 }
 
 void CoffeeMaker::BSpline::GenerateCurves(size_t precision) {
@@ -135,14 +158,110 @@ std::vector<CoffeeMaker::Math::Point2D> CoffeeMaker::BSpline::GetPoints() const
 
 CoffeeMaker::Math::Point2D CoffeeMaker::BSpline::Point2DAtKnot(tinyspline::real knot) {
   tinyspline::real filteredKnot = std::clamp(knot, 0.0, 1.0);
-  std::vector<tinyspline::real> temp = _tinysplineBSpline->eval(filteredKnot).result();
-  return CoffeeMaker::Math::Point2D{.x = static_cast<float>(temp[0]), .y = static_cast<float>(temp[1])};
+  if (_evalDirty) {
+    CacheEvaluation();
+  }
+  const size_t degree = _evalDegree;
+  const size_t numPoints = _evalPoints.size() / 2;
+  if (degree > MAX_EVAL_DEGREE || numPoints <= degree || _evalKnots.size() != numPoints + degree + 1) {
+    std::vector<tinyspline::real> temp = _tinysplineBSpline->eval(filteredKnot).result();
+    return CoffeeMaker::Math::Point2D{.x = static_cast<float>(temp[0]), .y = static_cast<float>(temp[1])};
+  }
+
+  // NOTE: find the knot span [t(k), t(k + 1)) holding the knot, the end of the domain belongs to the last span
+  const tinyspline::real* t = _evalKnots.data();
+  size_t k = degree;
+  while (k + 1 < numPoints && filteredKnot >= t[k + 1]) {
+    k++;
+  }
+
+  tinyspline::real x[MAX_EVAL_DEGREE + 1];
+  tinyspline::real y[MAX_EVAL_DEGREE + 1];
+  for (size_t j = 0; j <= degree; j++) {
+    x[j] = _evalPoints[(j + k - degree) * 2];
+    y[j] = _evalPoints[(j + k - degree) * 2 + 1];
+  }
+  for (size_t r = 1; r <= degree; r++) {
+    for (size_t j = degree; j >= r; j--) {
+      tinyspline::real span = t[j + 1 + k - r] - t[j + k - degree];
+      tinyspline::real alpha = span > 0.0 ? (filteredKnot - t[j + k - degree]) / span : 0.0;
+      x[j] = (1.0 - alpha) * x[j - 1] + alpha * x[j];
+      y[j] = (1.0 - alpha) * y[j - 1] + alpha * y[j];
+    }
+  }
+  return CoffeeMaker::Math::Point2D{.x = static_cast<float>(x[degree]), .y = static_cast<float>(y[degree])};
+}
+
+void CoffeeMaker::BSpline::CacheEvaluation() {
+  _evalKnots = _tinysplineBSpline->knots();
+  _evalPoints = _tinysplineBSpline->controlPoints();
+  _evalDegree = _tinysplineBSpline->degree();
+  _evalDirty = false;
+  // NOTE: the curve changed, the arc length table is rebuilt the next time it is needed
+  _arcDirty = true;
+}
+
+void CoffeeMaker::BSpline::BakeArcLength(size_t samples) {
+  samples = std::max(samples, static_cast<size_t>(1));
+  if (_evalDirty) {
+    CacheEvaluation();
+  }
+  std::vector<CoffeeMaker::Math::Point2D> points(samples + 1);
+  for (size_t i = 0; i <= samples; i++) {
+    points[i] = Point2DAtKnot(static_cast<tinyspline::real>(i) / static_cast<tinyspline::real>(samples));
+  }
+  std::vector<float> lengths = BakedSpline::ArcLengths(points);
+  _arc = BakedSpline(std::move(points), std::move(lengths));
+  _arcDirty = false;
+}
+
+float CoffeeMaker::BSpline::Length() {
+  if (_evalDirty || _arcDirty) {
+    BakeArcLength();
+  }
+  return _arc.Length();
+}
+
+CoffeeMaker::Math::Point2D CoffeeMaker::BSpline::Point2DAtDistance(float fraction) {
+  if (_evalDirty || _arcDirty) {
+    BakeArcLength();
+  }
+  return _arc.Point2DAtDistance(fraction);
+}
+
+CoffeeMaker::BakedSpline CoffeeMaker::BSpline::Bake(size_t samples) {
+  BakeArcLength(samples);
+  return _arc;
+}
+
+bool CoffeeMaker::BSpline::LoadBaked(const std::string& filePath, float width, float height, BakedSpline& baked) {
+  const float sx = width / SplineAsset::AUTHORED_WIDTH;
+  const float sy = height / SplineAsset::AUTHORED_HEIGHT;
+  std::filesystem::path bakedFilePath = std::filesystem::path(filePath).replace_extension(SplineAsset::EXTENSION);
+  CoffeeMaker::MappedFile file;
+  SplineAsset asset;
+  if (file.Open(CoffeeMaker::Utilities::AssetsDirectory() + "/" + bakedFilePath.string()) &&
+      SplineAsset::Decode(file.Data(), file.Size(), asset)) {
+    baked = asset.path.Scale(sx, sy);
+    return true;
+  }
+  // NOTE: no baked twin, ie: the assets were copied over again after the last build, bake it here instead
+  CM_LOGGER_WARN("[BSpline] No usable {} for {}, baking it at load time", bakedFilePath.string(), filePath);
+  std::vector<tinyspline::real> points = {};
+  if (!ReadControlPoints(CoffeeMaker::Utilities::AssetsDirectory() + "/" + filePath, points)) {
+    return false;
+  }
+  BSpline spline(points.size() / 2);
+  spline.SetControlPoints(points);
+  baked = spline.Bake().Scale(sx, sy);
+  return true;
 }
 
 void CoffeeMaker::BSpline::SetKnotAt(size_t index, tinyspline::real knot) {
   tinyspline::real clampedKnot = std::clamp(knot, 0.0, 1.0);
   std::vector<tinyspline::real> allKnots = _tinysplineBSpline->knots();
   _tinysplineBSpline->setKnotAt(index, clampedKnot);
+  _evalDirty = true;
 }
 
 void CoffeeMaker::BSpline::RemapControlPoints() {
@@ -152,9 +271,10 @@ void CoffeeMaker::BSpline::RemapControlPoints() {
   std::vector<Pt2> remappedPoints = {};
   std::vector<Pt2> currentPoints = GetControlPoints();
   for (size_t i = 0; i < currentPoints.size(); i++) {
-    remappedPoints.push_back(
-        Pt2{.x = Remap(0.0f, 2560.0f, 0.0f, CoffeeMaker::Renderer::GetOutputWidthF(), currentPoints[i].x),
-            .y = Remap(0.0f, 1440.0f, 0.0f, CoffeeMaker::Renderer::GetOutputHeightF(), currentPoints[i].y)});
+    remappedPoints.push_back(Pt2{.x = Remap(0.0f, SplineAsset::AUTHORED_WIDTH, 0.0f,
+                                            CoffeeMaker::Renderer::GetOutputWidthF(), currentPoints[i].x),
+                                 .y = Remap(0.0f, SplineAsset::AUTHORED_HEIGHT, 0.0f,
+                                            CoffeeMaker::Renderer::GetOutputHeightF(), currentPoints[i].y)});
   }
 
   SetControlPoints(remappedPoints);
@@ -238,6 +358,7 @@ void CoffeeMaker::Spline::Update(float deltaTime) {
 
 void CoffeeMaker::Spline::DebugRender() const {
   // Debug Bezier Curve
+  CoffeeMaker::Renderer::Flush();
   for (auto& point : _trail) {
     SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), CoffeeMaker::Colors::Yellow.r,
                            CoffeeMaker::Colors::Yellow.g, CoffeeMaker::Colors::Yellow.b, CoffeeMaker::Colors::Yellow.a);
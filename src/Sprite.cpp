@@ -26,13 +26,25 @@ CoffeeMaker::Sprite::Sprite(const std::string& filePath, float width, float heig
 
 CoffeeMaker::Sprite::~Sprite() {}
 
-void CoffeeMaker::Sprite::Render() { _texture->Render(clipRect, clientRect, rotation); }
+void CoffeeMaker::Sprite::Render() { _texture->Render(clipRect, RenderRect(), rotation); }
 
-void CoffeeMaker::Sprite::Render(SDL_Rect clip) { _texture->Render(clip, clientRect, rotation); }
+void CoffeeMaker::Sprite::Render(SDL_Rect clip) { _texture->Render(clip, RenderRect(), rotation); }
 
 void CoffeeMaker::Sprite::SetPosition(const CoffeeMaker::Math::Vector2D& pos) {
   clientRect.x = pos.x;
   clientRect.y = pos.y;
+  _position.Update(pos.x, pos.y);
+}
+
+SDL_FRect CoffeeMaker::Sprite::RenderRect() const {
+  SDL_FRect renderRect = clientRect;
+  SDL_FPoint current = _position.Current();
+  if (current.x == clientRect.x && current.y == clientRect.y) {
+    SDL_FPoint position = _position.Get();
+    renderRect.x = position.x;
+    renderRect.y = position.y;
+  }
+  return renderRect;
 }
 
 void CoffeeMaker::Sprite::SetAlpha(Uint8 alpha) { _texture->SetAlpha(alpha); }
@@ -1,12 +1,11 @@
 #include "Texture.hpp"
 
-#include <SDL2/SDL_image.h>
-
 #include <string>
 
 #include "Logger.hpp"
 #include "MessageBox.hpp"
 #include "Renderer.hpp"
+#include "TextureAtlas.hpp"
 #include "Utilities.hpp"
 
 using namespace CoffeeMaker;
@@ -52,68 +51,116 @@ void Texture::SetTextureDirectory() {
       fmt::format(fmt::runtime<std::string>("{}/{}"), CoffeeMaker::Utilities::AssetsDirectory(), "images");
 }
 
-Texture::Texture() : _texture(nullptr), _color(Color()), _height(0), _width(0), _useColorKey(false) {}
+namespace {
+  constexpr TextureModulation DEFAULT_MODULATION{
+      .color = {255, 255, 255, 255}, .alpha = 255, .blendMode = SDL_BLENDMODE_BLEND};
+
+  SDL_FRect ToFRect(const SDL_Rect &rect) {
+    return SDL_FRect{static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.w),
+                     static_cast<float>(rect.h)};
+  }
+}  // namespace
+
+Texture::Texture() :
+    _asset(nullptr),
+    _texture(nullptr),
+    _region{0, 0, 0, 0},
+    _color(Color()),
+    _modulation(DEFAULT_MODULATION),
+    _height(0),
+    _width(0),
+    _useColorKey(false) {}
 
 Texture::Texture(const std::string &filePath) :
-    _texture(nullptr), _color(Color()), _height(0), _width(0), _useColorKey(false) {
+    _asset(nullptr),
+    _texture(nullptr),
+    _region{0, 0, 0, 0},
+    _color(Color()),
+    _modulation(DEFAULT_MODULATION),
+    _height(0),
+    _width(0),
+    _useColorKey(false) {
   LoadFromFile(filePath);
 }
 
 Texture::Texture(const SDL_Color &color) :
-    _texture(nullptr), _color(color), _height(0), _width(0), _useColorKey(false) {}
+    _asset(nullptr),
+    _texture(nullptr),
+    _region{0, 0, 0, 0},
+    _color(color),
+    _modulation(DEFAULT_MODULATION),
+    _height(0),
+    _width(0),
+    _useColorKey(false) {}
+
+Texture::Texture(Ref<TextureAsset> asset) :
+    _asset(asset),
+    _texture(asset != nullptr ? asset->handle : nullptr),
+    _region{0, 0, asset != nullptr ? asset->width : 0, asset != nullptr ? asset->height : 0},
+    _color(Color()),
+    _modulation(asset != nullptr ? asset->base : DEFAULT_MODULATION),
+    _height(_region.h),
+    _width(_region.w),
+    _useColorKey(false) {}
 
 Texture::Texture(const std::string &filePath, bool useColorKey) :
-    _texture(nullptr), _height(0), _width(0), _useColorKey(useColorKey) {
+    _asset(nullptr),
+    _texture(nullptr),
+    _region{0, 0, 0, 0},
+    _color(Color()),
+    _modulation(DEFAULT_MODULATION),
+    _height(0),
+    _width(0),
+    _useColorKey(useColorKey) {
   LoadFromFile(filePath);
 }
 
-Texture::~Texture() {
-  if (_texture != nullptr) {
-    if (Renderer::Exists()) {
-      SDL_DestroyTexture(_texture);
-    }
-    _texture = nullptr;
-  }
-}
+Texture::~Texture() {}
 
 Texture &Texture::operator=(const Texture &rhs) {
   if (this == &rhs) {
     return *this;
   }
 
+  this->_asset = rhs._asset;
+  this->_texture = rhs._texture;
+  this->_region = rhs._region;
   this->_color = rhs._color;
+  this->_modulation = rhs._modulation;
   this->_width = rhs._width;
   this->_height = rhs._height;
-  if (rhs._texture != nullptr) {
-    this->_surface = std::move(rhs._surface);
-    this->_texture = SDL_CreateTextureFromSurface(CoffeeMaker::Renderer::Instance(), this->_surface);
-  }
+  this->_useColorKey = rhs._useColorKey;
 
   return *this;
 }
 
 void Texture::LoadFromFile(const std::string &filePath) {
-  _surface = nullptr;
-  std::string path = fmt::format(fmt::runtime("{}/{}"), Texture::_textureDirectory, filePath);
-  _surface = IMG_Load(path.c_str());
-  if (_surface == nullptr) {
-    std::string msg = fmt::format(fmt::runtime("Could not load surface at filepath {}"), filePath);
-    CM_LOGGER_ERROR(msg);
-    CoffeeMaker::MessageBox::ShowMessageBoxAndQuit("Error loading texture", msg);
-    return;
+  // NOTE: atlas pages have the color key baked in, textures without it load their own copy
+  const AtlasRegion *region = _useColorKey ? TextureAtlas::Find(filePath) : nullptr;
+  if (region != nullptr) {
+    _asset = region->page;
+    _region = region->rect;
+  } else {
+    std::string path = fmt::format(fmt::runtime("{}/{}"), Texture::_textureDirectory, filePath);
+    _asset = TextureRegistry::Load(path, _useColorKey);
+    if (_asset == nullptr) {
+      _texture = nullptr;
+      return;
+    }
+    _region = SDL_Rect{0, 0, _asset->width, _asset->height};
   }
 
-  if (_useColorKey) {
-    SDL_SetColorKey(_surface, SDL_TRUE, SDL_MapRGB(_surface->format, COLOR_KEY.r, COLOR_KEY.g, COLOR_KEY.b));
-  }
-  _texture = SDL_CreateTextureFromSurface(CoffeeMaker::Renderer::Instance(), _surface);
-  _height = _surface->h;
-  _width = _surface->w;
-  SDL_FreeSurface(_surface);
+  _texture = _asset->handle;
+  _modulation = _asset->base;
+  _height = _region.h;
+  _width = _region.w;
 }
 
 void Texture::CreateFromSurface(int height, int width, const SDL_Color &c) {
-  _texture = createRectTextureFromSurface(height, width, c);
+  _asset = TextureRegistry::Adopt(createRectTextureFromSurface(height, width, c), width, height);
+  _texture = _asset->handle;
+  _region = SDL_Rect{0, 0, width, height};
+  _modulation = _asset->base;
   _width = 10;
   _height = 25;
 }
@@ -122,50 +169,54 @@ void Texture::Render(int top, int left) {
   SDL_Rect renderQuad = {.x = left, .y = top, .w = _width, .h = _height};
 
   if (_texture == nullptr) {
+    CoffeeMaker::Renderer::Flush();
     SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), _color.r, _color.g, _color.b, _color.a);
     SDL_RenderFillRect(CoffeeMaker::Renderer::Instance(), &renderQuad);
     return;
   }
 
-  SDL_RenderCopy(CoffeeMaker::Renderer::Instance(), _texture, NULL, &renderQuad);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  Modulate();
+  CoffeeMaker::Renderer::DrawSprite(_texture, _region, ToFRect(renderQuad), 0.0, SDL_FLIP_NONE, VertexColor());
 }
 
 void Texture::Render(float top, float left) {
   SDL_FRect renderQuad = {.x = left, .y = top, .w = (float)_width, .h = (float)_height};
 
   if (_texture == nullptr) {
+    CoffeeMaker::Renderer::Flush();
     SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), _color.r, _color.g, _color.b, _color.a);
     SDL_RenderDrawRectF(CoffeeMaker::Renderer::Instance(), &renderQuad);
     return;
   }
 
-  SDL_RenderCopyF(CoffeeMaker::Renderer::Instance(), _texture, NULL, &renderQuad);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  Modulate();
+  CoffeeMaker::Renderer::DrawSprite(_texture, _region, renderQuad, 0.0, SDL_FLIP_NONE, VertexColor());
 }
 
 void Texture::Render(int top, int left, int height, int width) {
   SDL_Rect renderQuad = {.x = left, .y = top, .w = width, .h = height};
 
   if (_texture == nullptr) {
+    CoffeeMaker::Renderer::Flush();
     SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), _color.r, _color.g, _color.b, _color.a);
     SDL_RenderFillRect(CoffeeMaker::Renderer::Instance(), &renderQuad);
     return;
   }
 
-  SDL_RenderCopy(CoffeeMaker::Renderer::Instance(), _texture, NULL, &renderQuad);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  Modulate();
+  CoffeeMaker::Renderer::DrawSprite(_texture, _region, ToFRect(renderQuad), 0.0, SDL_FLIP_NONE, VertexColor());
 }
 
 void Texture::Render(const SDL_Rect &clip, const SDL_Rect &renderRect) {
   if (_texture == nullptr) {
+    CoffeeMaker::Renderer::Flush();
     SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), _color.r, _color.g, _color.b, _color.a);
     SDL_RenderFillRect(CoffeeMaker::Renderer::Instance(), &renderRect);
     return;
   }
 
-  SDL_RenderCopy(CoffeeMaker::Renderer::Instance(), _texture, &clip, &renderRect);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  Modulate();
+  CoffeeMaker::Renderer::DrawSprite(_texture, Source(clip), ToFRect(renderRect), 0.0, SDL_FLIP_NONE, VertexColor());
 }
 
 void Texture::Render(const SDL_Rect &clip, const SDL_Rect &renderRect, double rotation) {
@@ -173,9 +224,9 @@ void Texture::Render(const SDL_Rect &clip, const SDL_Rect &renderRect, double ro
     CoffeeMaker::MessageBox::ShowMessageBoxAndQuit("Error rendering texture", "Cannot render texture with nullptr");
     return;
   }
-  SDL_RendererFlip flip = SDL_FLIP_NONE;
-  SDL_RenderCopyEx(CoffeeMaker::Renderer::Instance(), _texture, &clip, &renderRect, rotation, NULL, flip);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  Modulate();
+  CoffeeMaker::Renderer::DrawSprite(_texture, Source(clip), ToFRect(renderRect), rotation, SDL_FLIP_NONE,
+                                    VertexColor());
 }
 
 void Texture::Render(const SDL_Rect &clip, const SDL_FRect &renderRect, double rotation) {
@@ -183,9 +234,8 @@ void Texture::Render(const SDL_Rect &clip, const SDL_FRect &renderRect, double r
     CoffeeMaker::MessageBox::ShowMessageBoxAndQuit("Error rendering texture", "Cannot render texture with nullptr");
     return;
   }
-  SDL_RendererFlip flip = SDL_FLIP_NONE;
-  SDL_RenderCopyExF(CoffeeMaker::Renderer::Instance(), _texture, &clip, &renderRect, rotation, NULL, flip);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  Modulate();
+  CoffeeMaker::Renderer::DrawSprite(_texture, Source(clip), renderRect, rotation, SDL_FLIP_NONE, VertexColor());
 }
 
 void Texture::Render(const SDL_Rect &clip, const SDL_FRect &renderRect, double rotation, SDL_RendererFlip flip) {
@@ -193,8 +243,8 @@ void Texture::Render(const SDL_Rect &clip, const SDL_FRect &renderRect, double r
     CoffeeMaker::MessageBox::ShowMessageBoxAndQuit("Error rendering texture", "Cannot render texture with nullptr");
     return;
   }
-  SDL_RenderCopyExF(CoffeeMaker::Renderer::Instance(), _texture, &clip, &renderRect, rotation, NULL, flip);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  Modulate();
+  CoffeeMaker::Renderer::DrawSprite(_texture, Source(clip), renderRect, rotation, flip, VertexColor());
 }
 
 void Texture::Render(const SDL_Rect &renderRect, double rotation) {
@@ -202,9 +252,8 @@ void Texture::Render(const SDL_Rect &renderRect, double rotation) {
     CoffeeMaker::MessageBox::ShowMessageBoxAndQuit("Error rendering texture", "Cannot render texture with nullptr");
     return;
   }
-  SDL_RendererFlip flip = SDL_FLIP_NONE;
-  SDL_RenderCopyEx(CoffeeMaker::Renderer::Instance(), _texture, NULL, &renderRect, rotation, NULL, flip);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  Modulate();
+  CoffeeMaker::Renderer::DrawSprite(_texture, _region, ToFRect(renderRect), rotation, SDL_FLIP_NONE, VertexColor());
 }
 
 void Texture::SetAlpha(Uint8 alpha) {
@@ -212,7 +261,7 @@ void Texture::SetAlpha(Uint8 alpha) {
     Logger::Error("Could not set alpha on NULL texture");
     return;
   }
-  SDL_SetTextureAlphaMod(_texture, alpha);
+  _modulation.alpha = alpha;
 }
 
 void Texture::SetColor(SDL_Color color) {
@@ -220,13 +269,15 @@ void Texture::SetColor(SDL_Color color) {
     _color = color;
     return;
   }
-  SDL_SetTextureColorMod(_texture, color.r, color.g, color.b);
+  _modulation.color = color;
 }
 
 SDL_Color Texture::GetColorMod() {
   SDL_Color colorMod = {.r = 255, .g = 255, .b = 255, .a = 255};
   if (_texture != nullptr) {
-    SDL_GetTextureColorMod(_texture, &colorMod.r, &colorMod.g, &colorMod.b);
+    colorMod.r = _modulation.color.r;
+    colorMod.g = _modulation.color.g;
+    colorMod.b = _modulation.color.b;
   }
   return colorMod;
 }
@@ -236,7 +287,7 @@ void Texture::SetBlendMode(SDL_BlendMode blend) {
     Logger::Error("Could not set blend mode on NULL texture");
     return;
   }
-  SDL_SetTextureBlendMode(_texture, blend);
+  _modulation.blendMode = blend;
 }
 
 int Texture::Height() const { return _height; }
@@ -248,3 +299,25 @@ void Texture::SetHeight(int const height) { _height = height; }
 void Texture::SetWidth(int const width) { _width = width; }
 
 SDL_Texture *Texture::Handle() const { return _texture; }
+
+const SDL_Rect &Texture::Region() const { return _region; }
+
+SDL_Rect Texture::Source(const SDL_Rect &clip) const {
+  return SDL_Rect{clip.x + _region.x, clip.y + _region.y, clip.w, clip.h};
+}
+
+void Texture::Modulate() {
+  TextureModulation &applied = _asset->applied;
+  // NOTE: SDL_RenderGeometry ignores the texture's color and alpha mod, those go into the vertices, see VertexColor
+  if (applied.blendMode == _modulation.blendMode) {
+    return;
+  }
+  // NOTE: quads already queued for this handle were meant to be drawn with the previous blend mode
+  CoffeeMaker::Renderer::Flush();
+  SDL_SetTextureBlendMode(_texture, _modulation.blendMode);
+  applied.blendMode = _modulation.blendMode;
+}
+
+SDL_Color Texture::VertexColor() const {
+  return SDL_Color{_modulation.color.r, _modulation.color.g, _modulation.color.b, _modulation.alpha};
+}
@@ -0,0 +1,198 @@
+#include "TextureAtlas.hpp"
+
+#include <SDL2/SDL_image.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+#include <system_error>
+
+#include "Logger.hpp"
+#include "Renderer.hpp"
+#include "Texture.hpp"
+#include "ThreadPool.hpp"
+
+using namespace CoffeeMaker;
+
+std::unordered_map<std::string, AtlasRegion> TextureAtlas::_regions = {};
+std::vector<Ref<TextureAsset>> TextureAtlas::_pages = {};
+
+std::vector<TextureAtlas::Placement> TextureAtlas::Pack(const std::vector<SDL_Point>& sizes, int pageSize,
+                                                         int padding) {
+  std::vector<Placement> placements(sizes.size(), Placement{.page = -1, .x = 0, .y = 0});
+  std::vector<size_t> order(sizes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&sizes](size_t a, size_t b) {
+    return sizes[a].y != sizes[b].y ? sizes[a].y > sizes[b].y : sizes[a].x > sizes[b].x;
+  });
+
+  int page = 0;
+  int x = 0;
+  int y = 0;
+  int shelfHeight = 0;
+  for (size_t i : order) {
+    int width = sizes[i].x + 2 * padding;
+    int height = sizes[i].y + 2 * padding;
+    if (width > pageSize || height > pageSize) {
+      continue;
+    }
+    if (x + width > pageSize) {
+      y += shelfHeight;
+      x = 0;
+      shelfHeight = 0;
+    }
+    if (y + height > pageSize) {
+      page++;
+      x = 0;
+      y = 0;
+      shelfHeight = 0;
+    }
+    placements[i] = Placement{.page = page, .x = x + padding, .y = y + padding};
+    x += width;
+    shelfHeight = std::max(shelfHeight, height);
+  }
+  return placements;
+}
+
+void TextureAtlas::Build() {
+  Destroy();
+
+  std::vector<Entry> entries;
+  const std::string assetsDirectory = CoffeeMaker::Utilities::AssetsDirectory();
+  // NOTE: assets/animations is not packed, the sprite sheets the game loads are copies under assets/images
+  CollectEntries(assetsDirectory + "/images", "", entries);
+  if (entries.empty()) {
+    return;
+  }
+
+  std::vector<SDL_Point> sizes;
+  sizes.reserve(entries.size());
+  for (const Entry& entry : entries) {
+    sizes.push_back(SDL_Point{entry.surface->w, entry.surface->h});
+  }
+  std::vector<Placement> placements = Pack(sizes, PAGE_SIZE, PADDING);
+
+  int numPages = 0;
+  for (const Placement& placement : placements) {
+    numPages = std::max(numPages, placement.page + 1);
+  }
+  std::vector<SDL_Surface*> pages;
+  for (int i = 0; i < numPages; i++) {
+    SDL_Surface* page = SDL_CreateRGBSurfaceWithFormat(0, PAGE_SIZE, PAGE_SIZE, 32, SDL_PIXELFORMAT_RGBA32);
+    SDL_FillRect(page, NULL, 0);
+    pages.push_back(page);
+  }
+
+  for (size_t i = 0; i < entries.size(); i++) {
+    const Placement& placement = placements[i];
+    if (placement.page >= 0) {
+      BlitExtruded(entries[i].surface, pages[placement.page], placement.x, placement.y);
+      SDL_Rect rect{placement.x, placement.y, entries[i].surface->w, entries[i].surface->h};
+      _regions.emplace(entries[i].name, AtlasRegion{.page = nullptr, .rect = rect});
+    }
+  }
+
+  for (SDL_Surface* page : pages) {
+    _pages.push_back(
+        TextureRegistry::Adopt(SDL_CreateTextureFromSurface(Renderer::Instance(), page), PAGE_SIZE, PAGE_SIZE));
+    SDL_FreeSurface(page);
+  }
+  for (size_t i = 0; i < entries.size(); i++) {
+    if (placements[i].page >= 0) {
+      _regions[entries[i].name].page = _pages[placements[i].page];
+    }
+    SDL_FreeSurface(entries[i].surface);
+  }
+
+  CM_LOGGER_INFO("[TextureAtlas] Packed {} images onto {} page(s)", _regions.size(), _pages.size());
+}
+
+void TextureAtlas::Destroy() {
+  _regions.clear();
+  _pages.clear();
+}
+
+const AtlasRegion* TextureAtlas::Find(const std::string& name) {
+  auto it = _regions.find(name);
+  if (it == _regions.end()) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+size_t TextureAtlas::NumPages() { return _pages.size(); }
+
+size_t TextureAtlas::NumRegions() { return _regions.size(); }
+
+void TextureAtlas::CollectEntries(const std::string& directory, const std::string& prefix,
+                                  std::vector<Entry>& entries) {
+  std::error_code error;
+  std::vector<std::filesystem::path> files;
+  for (const auto& file : std::filesystem::directory_iterator(directory, error)) {
+    if (file.is_regular_file() && file.path().extension() == ".png") {
+      files.push_back(file.path());
+    }
+  }
+  if (error) {
+    CM_LOGGER_WARN("[TextureAtlas] Could not read {}: {}", directory, error.message());
+  }
+
+  // NOTE: decoding dominates the build, every image is decoded and converted on its own surface so the pool can
+  // take them in parallel, the renderer is only touched back on this thread
+  std::vector<SDL_Surface*> surfaces(files.size(), nullptr);
+  Async::ThreadPool::Instance()->ParallelFor(0, files.size(), 1, [&files, &surfaces](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      surfaces[i] = LoadSurface(files[i]);
+    }
+  });
+  for (size_t i = 0; i < files.size(); i++) {
+    if (surfaces[i] != nullptr) {
+      entries.push_back(Entry{.name = prefix + files[i].filename().string(), .surface = surfaces[i]});
+    }
+  }
+}
+
+SDL_Surface* TextureAtlas::LoadSurface(const std::filesystem::path& filePath) {
+  SDL_Surface* loaded = IMG_Load(filePath.string().c_str());
+  if (loaded == nullptr) {
+    CM_LOGGER_WARN("[TextureAtlas] Could not load {}", filePath.string());
+    return nullptr;
+  }
+  if (loaded->w > MAX_REGION_SIZE || loaded->h > MAX_REGION_SIZE) {
+    SDL_FreeSurface(loaded);
+    return nullptr;
+  }
+  // NOTE: converting to a format with alpha turns color keyed pixels transparent
+  SDL_SetColorKey(loaded, SDL_TRUE,
+                  SDL_MapRGB(loaded->format, Texture::COLOR_KEY.r, Texture::COLOR_KEY.g, Texture::COLOR_KEY.b));
+  SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+  SDL_FreeSurface(loaded);
+  return surface;
+}
+
+void TextureAtlas::BlitExtruded(SDL_Surface* image, SDL_Surface* page, int x, int y) {
+  static_assert(PADDING >= 1, "extruding needs at least one pixel of padding");
+  struct Strip {
+    SDL_Rect source;
+    SDL_Rect destination;
+  };
+  const int w = image->w;
+  const int h = image->h;
+  const Strip strips[] = {
+      // NOTE: the image itself, then its edges and corners copied one pixel outwards
+      {{0, 0, w, h}, {x, y, w, h}},
+      {{0, 0, w, 1}, {x, y - 1, w, 1}},
+      {{0, h - 1, w, 1}, {x, y + h, w, 1}},
+      {{0, 0, 1, h}, {x - 1, y, 1, h}},
+      {{w - 1, 0, 1, h}, {x + w, y, 1, h}},
+      {{0, 0, 1, 1}, {x - 1, y - 1, 1, 1}},
+      {{w - 1, 0, 1, 1}, {x + w, y - 1, 1, 1}},
+      {{0, h - 1, 1, 1}, {x - 1, y + h, 1, 1}},
+      {{w - 1, h - 1, 1, 1}, {x + w, y + h, 1, 1}},
+  };
+  SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_NONE);
+  for (const Strip& strip : strips) {
+    SDL_Rect destination = strip.destination;
+    SDL_BlitSurface(image, &strip.source, page, &destination);
+  }
+}
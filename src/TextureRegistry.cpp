@@ -0,0 +1,107 @@
+#include "TextureRegistry.hpp"
+
+#include <SDL2/SDL_image.h>
+
+#include "Logger.hpp"
+#include "MessageBox.hpp"
+#include "Renderer.hpp"
+#include "Texture.hpp"
+
+using namespace CoffeeMaker;
+
+std::unordered_map<std::string, std::weak_ptr<TextureAsset>> TextureRegistry::_assets = {};
+size_t TextureRegistry::_loads = 0;
+size_t TextureRegistry::_hits = 0;
+
+bool TextureModulation::operator==(const TextureModulation& rhs) const {
+  return color.r == rhs.color.r && color.g == rhs.color.g && color.b == rhs.color.b && alpha == rhs.alpha &&
+         blendMode == rhs.blendMode;
+}
+
+Ref<TextureAsset> TextureRegistry::Load(const std::string& filePath, bool useColorKey) {
+  std::string key = Key(filePath, useColorKey);
+  auto it = _assets.find(key);
+  if (it != _assets.end()) {
+    Ref<TextureAsset> asset = it->second.lock();
+    if (asset != nullptr) {
+      _hits++;
+      return asset;
+    }
+  }
+
+  SDL_Surface* surface = IMG_Load(filePath.c_str());
+  if (surface == nullptr) {
+    std::string msg = fmt::format(fmt::runtime("Could not load surface at filepath {}"), filePath);
+    CM_LOGGER_ERROR(msg);
+    CoffeeMaker::MessageBox::ShowMessageBoxAndQuit("Error loading texture", msg);
+    return nullptr;
+  }
+  if (useColorKey) {
+    SDL_SetColorKey(surface, SDL_TRUE,
+                    SDL_MapRGB(surface->format, Texture::COLOR_KEY.r, Texture::COLOR_KEY.g, Texture::COLOR_KEY.b));
+  }
+  SDL_Texture* texture = SDL_CreateTextureFromSurface(CoffeeMaker::Renderer::Instance(), surface);
+  Ref<TextureAsset> asset = Manage(texture, surface->w, surface->h);
+  SDL_FreeSurface(surface);
+
+  _loads++;
+  _assets[key] = asset;
+  return asset;
+}
+
+Ref<TextureAsset> TextureRegistry::Adopt(SDL_Texture* texture, int width, int height) {
+  return Manage(texture, width, height);
+}
+
+Ref<TextureAsset> TextureRegistry::Manage(SDL_Texture* texture, int width, int height) {
+  TextureModulation modulation{.color = {255, 255, 255, 255}, .alpha = 255, .blendMode = SDL_BLENDMODE_NONE};
+  if (texture != nullptr) {
+    SDL_GetTextureColorMod(texture, &modulation.color.r, &modulation.color.g, &modulation.color.b);
+    SDL_GetTextureAlphaMod(texture, &modulation.alpha);
+    SDL_GetTextureBlendMode(texture, &modulation.blendMode);
+  }
+  return Ref<TextureAsset>(new TextureAsset{.handle = texture,
+                                            .width = width,
+                                            .height = height,
+                                            .base = modulation,
+                                            .applied = modulation},
+                           &TextureRegistry::Release);
+}
+
+void TextureRegistry::Release(TextureAsset* asset) {
+  // NOTE: the registry entry is left to expire, it is replaced on the next load or dropped by Prune
+  if (asset->handle != nullptr && Renderer::Exists()) {
+    // NOTE: quads may still be queued for this handle
+    Renderer::Flush();
+    SDL_DestroyTexture(asset->handle);
+  }
+  delete asset;
+}
+
+size_t TextureRegistry::Size() {
+  size_t size = 0;
+  for (const auto& [key, asset] : _assets) {
+    if (!asset.expired()) {
+      size++;
+    }
+  }
+  return size;
+}
+
+size_t TextureRegistry::Loads() { return _loads; }
+
+size_t TextureRegistry::Hits() { return _hits; }
+
+void TextureRegistry::Prune() {
+  for (auto it = _assets.begin(); it != _assets.end();) {
+    if (it->second.expired()) {
+      it = _assets.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+std::string TextureRegistry::Key(const std::string& filePath, bool useColorKey) {
+  return useColorKey ? filePath + "#colorkey" : filePath;
+}
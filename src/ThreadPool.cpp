@@ -0,0 +1,194 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include "Logger.hpp"
+
+using namespace CoffeeMaker::Async;
+
+namespace {
+  thread_local ThreadPool* currentPool = nullptr;
+  thread_local size_t currentWorker = 0;
+
+  struct ParallelForState {
+    size_t begin;
+    size_t end;
+    size_t grain;
+    size_t chunks;
+    const std::function<void(size_t, size_t)>* body;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    /**
+     * @brief Claims and runs chunks until there are none left. body is only touched after a chunk was claimed, so
+     * a helper that starts after ParallelFor returned never reads it.
+     */
+    void Work() {
+      for (size_t chunk = next.fetch_add(1); chunk < chunks; chunk = next.fetch_add(1)) {
+        const size_t first = begin + chunk * grain;
+        try {
+          (*body)(first, std::min(first + grain, end));
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(exceptionMutex);
+          if (!exception) {
+            exception = std::current_exception();
+          }
+        }
+        done.fetch_add(1, std::memory_order_release);
+      }
+    }
+  };
+
+  void RunJob(const ThreadPool::Job& job) {
+    try {
+      job();
+    } catch (const std::exception& e) {
+      CM_LOGGER_ERROR("[ThreadPool] Job threw: {}", e.what());
+    } catch (...) {
+      CM_LOGGER_ERROR("[ThreadPool] Job threw an unknown exception");
+    }
+  }
+}  // namespace
+
+size_t ThreadPool::DefaultNumWorkers() {
+  const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+  return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+}
+
+ThreadPool::ThreadPool(size_t numWorkers) :
+    _workers(), _threads(), _nextWorker(0), _pending(0), _sleepMutex(), _wake(), _stopping(false) {
+  numWorkers = std::max<size_t>(numWorkers, 1);
+  for (size_t i = 0; i < numWorkers; i++) {
+    _workers.push_back(std::make_unique<Worker>());
+  }
+  // NOTE: every deque exists before the first thread starts, so workers can steal from each other right away
+  for (size_t i = 0; i < numWorkers; i++) {
+    _threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _stopping = true;
+  }
+  _wake.notify_all();
+  for (std::thread& thread : _threads) {
+    thread.join();
+  }
+}
+
+void ThreadPool::Submit(Job job) {
+  const size_t index = IsWorker() ? currentWorker : _nextWorker.fetch_add(1) % _workers.size();
+  // NOTE: counted before it is queued so a thief taking it straight away never sends the count below zero
+  _pending.fetch_add(1);
+  {
+    std::lock_guard<std::mutex> lock(_workers[index]->mutex);
+    _workers[index]->jobs.push_back(std::move(job));
+  }
+  {
+    // NOTE: taking the lock orders the notify after a sleeping worker checked _pending, so no wake up is lost
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+  }
+  _wake.notify_one();
+}
+
+void ThreadPool::ParallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body) {
+  if (end <= begin) {
+    return;
+  }
+  const size_t count = end - begin;
+  if (grain == 0) {
+    grain = std::max<size_t>(count / ((_workers.size() + 1) * 4), 1);
+  }
+
+  auto state = std::make_shared<ParallelForState>();
+  state->begin = begin;
+  state->end = end;
+  state->grain = grain;
+  state->chunks = (count + grain - 1) / grain;
+  state->body = &body;
+
+  const size_t helpers = std::min(_workers.size(), state->chunks - 1);
+  for (size_t i = 0; i < helpers; i++) {
+    Submit([state]() { state->Work(); });
+  }
+  state->Work();
+  // NOTE: every chunk is claimed by now, only the ones still running on other threads are waited for
+  while (state->done.load(std::memory_order_acquire) < state->chunks) {
+    std::this_thread::yield();
+  }
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+bool ThreadPool::RunPendingJob() {
+  Job job;
+  const bool found = IsWorker() ? (Pop(currentWorker, job) || Steal(currentWorker, job))
+                                : Steal(_nextWorker.load() % _workers.size(), job);
+  if (found) {
+    RunJob(job);
+  }
+  return found;
+}
+
+size_t ThreadPool::NumWorkers() const { return _workers.size(); }
+
+bool ThreadPool::IsWorker() const { return currentPool == this; }
+
+ThreadPool* ThreadPool::Instance() {
+  static ThreadPool pool;
+  return &pool;
+}
+
+void ThreadPool::WorkerLoop(size_t index) {
+  currentPool = this;
+  currentWorker = index;
+  Job job;
+  while (true) {
+    if (Pop(index, job) || Steal(index, job)) {
+      RunJob(job);
+      job = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(_sleepMutex);
+    _wake.wait(lock, [this]() { return _stopping || _pending.load() > 0; });
+    if (_stopping && _pending.load() == 0) {
+      return;
+    }
+  }
+}
+
+bool ThreadPool::Pop(size_t index, Job& job) {
+  Worker& worker = *_workers[index];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  if (worker.jobs.empty()) {
+    return false;
+  }
+  // NOTE: newest first, it is the job most likely to still be in this core's cache
+  job = std::move(worker.jobs.back());
+  worker.jobs.pop_back();
+  _pending.fetch_sub(1);
+  return true;
+}
+
+bool ThreadPool::Steal(size_t thief, Job& job) {
+  const size_t numWorkers = _workers.size();
+  for (size_t i = 1; i <= numWorkers; i++) {
+    Worker& victim = *_workers[(thief + i) % numWorkers];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.jobs.empty()) {
+      // NOTE: oldest first, leaving the owner the work it queued most recently
+      job = std::move(victim.jobs.front());
+      victim.jobs.pop_front();
+      _pending.fetch_sub(1);
+      return true;
+    }
+  }
+  return false;
+}
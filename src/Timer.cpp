@@ -2,13 +2,19 @@
 
 using namespace CoffeeMaker;
 
+Timer::Clock Timer::_clock = nullptr;
+
 Timer::Timer() : _startTicks(0), _pausedTicks(0), _paused(false), _started(false) {}
 
+void Timer::SetClock(Clock clock) { _clock = std::move(clock); }
+
+Uint32 Timer::Now() { return _clock ? _clock() : SDL_GetTicks(); }
+
 void Timer::Start() {
   _started = true;
   _paused = false;
 
-  _startTicks = SDL_GetTicks();
+  _startTicks = Now();
   _pausedTicks = 0;
 }
 
@@ -22,7 +28,7 @@ void Timer::Stop() {
 void Timer::Pause() {
   if (_started && !_paused) {
     _paused = true;
-    _pausedTicks = SDL_GetTicks() - _startTicks;
+    _pausedTicks = Now() - _startTicks;
     _startTicks = 0;
   }
 }
@@ -31,7 +37,7 @@ void Timer::Unpause() {
   if (_started && _paused) {
     _paused = false;
 
-    _startTicks = SDL_GetTicks() - _pausedTicks;
+    _startTicks = Now() - _pausedTicks;
     _pausedTicks = 0;
   }
 }
@@ -43,7 +49,7 @@ Uint32 Timer::GetTicks() {
     if (_paused) {
       time = _pausedTicks;
     } else {
-      time = SDL_GetTicks() - _startTicks;
+      time = Now() - _startTicks;
     }
   }
 
@@ -0,0 +1,195 @@
+#include "TimerWheel.hpp"
+
+#include <algorithm>
+
+using namespace CoffeeMaker::Async;
+
+CoffeeMaker::Async::TimerNode::~TimerNode() {
+  if (_wheel != nullptr) {
+    _wheel->Cancel(this);
+  }
+}
+
+void CoffeeMaker::Async::TimerNode::Link(TimerNode* head) {
+  _prev = head->_prev;
+  _next = head;
+  head->_prev->_next = this;
+  head->_prev = this;
+}
+
+void CoffeeMaker::Async::TimerNode::Unlink() {
+  if (_next != nullptr) {
+    _prev->_next = _next;
+    _next->_prev = _prev;
+    _prev = nullptr;
+    _next = nullptr;
+  }
+}
+
+TimerWheel::TimerWheel() : _currentTick(0), _lastTicks(0), _started(false), _paused(false), _numScheduled(0) {
+  for (auto& slot : _slots) {
+    slot._prev = &slot;
+    slot._next = &slot;
+  }
+  _expired._prev = &_expired;
+  _expired._next = &_expired;
+}
+
+TimerWheel::~TimerWheel() {
+  // NOTE: detach anything still scheduled so owners that outlive the wheel don't touch it on destruction.
+  auto detach = [](TimerNode& head) {
+    while (head._next != &head) {
+      TimerNode* node = head._next;
+      node->Unlink();
+      node->_wheel = nullptr;
+    }
+  };
+  for (auto& slot : _slots) {
+    detach(slot);
+  }
+  detach(_expired);
+}
+
+TimerWheel* TimerWheel::Instance() {
+  static TimerWheel wheel;
+  return &wheel;
+}
+
+void TimerWheel::ProcessTimers() { Instance()->Update(SDL_GetTicks()); }
+
+void TimerWheel::PauseAllTimers() { Instance()->Pause(); }
+
+void TimerWheel::UnpauseAllTimers() { Instance()->Unpause(); }
+
+void TimerWheel::Schedule(TimerNode* node, Uint32 delay, Uint32 period) {
+  if (node->_wheel != nullptr) {
+    node->_wheel->Cancel(node);
+  }
+  node->_wheel = this;
+  // NOTE: the current tick has already been drained, so the soonest a node can fire is the next tick.
+  node->_expires = _currentTick + std::max(delay, static_cast<Uint32>(1));
+  node->_period = period;
+  _numScheduled++;
+  Insert(node);
+}
+
+void TimerWheel::Cancel(TimerNode* node) {
+  if (node->_wheel == this) {
+    node->Unlink();
+    node->_wheel = nullptr;
+    _numScheduled--;
+  }
+}
+
+Uint32 TimerWheel::Remaining(const TimerNode* node) const {
+  if (node->_wheel != this || node->_expires <= _currentTick) {
+    return 0;
+  }
+  return static_cast<Uint32>(node->_expires - _currentTick);
+}
+
+void TimerWheel::Insert(TimerNode* node) {
+  node->_expires = std::max(node->_expires, _currentTick);
+  std::uint64_t delta = std::min(node->_expires - _currentTick, MAX_DELAY);
+  std::uint64_t slotExpires = _currentTick + delta;
+
+  unsigned int level = 0;
+  while (level < NUM_LEVELS - 1 && delta >= (static_cast<std::uint64_t>(1) << ((level + 1) * SLOT_BITS))) {
+    level++;
+  }
+
+  unsigned int index = static_cast<unsigned int>((slotExpires >> (level * SLOT_BITS)) & SLOT_MASK);
+  node->Link(&_slots[level * NUM_SLOTS + index]);
+}
+
+void TimerWheel::Splice(TimerNode* from, TimerNode* to) {
+  if (from->_next == from) {
+    return;
+  }
+  TimerNode* first = from->_next;
+  TimerNode* last = from->_prev;
+  first->_prev = to->_prev;
+  to->_prev->_next = first;
+  last->_next = to;
+  to->_prev = last;
+  from->_next = from;
+  from->_prev = from;
+}
+
+void TimerWheel::Cascade(unsigned int level, unsigned int index) {
+  TimerNode pending;
+  pending._prev = &pending;
+  pending._next = &pending;
+  Splice(&_slots[level * NUM_SLOTS + index], &pending);
+  while (pending._next != &pending) {
+    TimerNode* node = pending._next;
+    node->Unlink();
+    Insert(node);
+  }
+}
+
+void TimerWheel::Tick() {
+  _currentTick++;
+  unsigned int index = static_cast<unsigned int>(_currentTick & SLOT_MASK);
+  if (index == 0) {
+    // NOTE: the finest level wrapped, pull the next slot of each coarser level down until one doesn't wrap.
+    for (unsigned int level = 1; level < NUM_LEVELS; level++) {
+      unsigned int levelIndex = static_cast<unsigned int>((_currentTick >> (level * SLOT_BITS)) & SLOT_MASK);
+      Cascade(level, levelIndex);
+      if (levelIndex != 0) {
+        break;
+      }
+    }
+  }
+
+  Splice(&_slots[index], &_expired);
+
+  while (_expired._next != &_expired) {
+    TimerNode* node = _expired._next;
+    node->Unlink();
+    if (node->_period > 0) {
+      node->_expires += node->_period;
+      Insert(node);
+    } else {
+      node->_wheel = nullptr;
+      _numScheduled--;
+    }
+    // NOTE: the callback is free to cancel or reschedule its own node, or any other node.
+    if (node->_callback) {
+      node->_callback();
+    }
+  }
+}
+
+void TimerWheel::Advance(Uint32 milliseconds) {
+  if (_numScheduled == 0) {
+    _currentTick += milliseconds;
+    return;
+  }
+  for (Uint32 i = 0; i < milliseconds; i++) {
+    Tick();
+  }
+}
+
+void TimerWheel::Update(Uint32 currentTicks) {
+  if (!_started) {
+    _started = true;
+    _lastTicks = currentTicks;
+    return;
+  }
+  Uint32 elapsed = currentTicks - _lastTicks;
+  _lastTicks = currentTicks;
+  if (!_paused) {
+    Advance(elapsed);
+  }
+}
+
+void TimerWheel::Pause() { _paused = true; }
+
+void TimerWheel::Unpause() { _paused = false; }
+
+bool TimerWheel::IsPaused() const { return _paused; }
+
+std::uint64_t TimerWheel::CurrentTick() const { return _currentTick; }
+
+size_t TimerWheel::NumScheduled() const { return _numScheduled; }
@@ -12,7 +12,6 @@ using namespace CoffeeMaker;
 std::map<std::string, Button *> Button::buttons = {};
 std::queue<Event *> Button::eventQueue;
 int Button::_buttonUid = 0;
-std::map<std::string, Ref<Texture>> Button::_cachedTextures = {};
 
 Delegate *createButtonDelegate(std::function<void(const Event &event)> fn) { return new Delegate(fn); }
 
@@ -39,25 +38,13 @@ Button::Button(const SDL_Color &defaultColor, const SDL_Color &hoveredColor, Uin
   _AttachDefaultEvents();
 }
 
-Button::Button(const std::string &defaultTexture, const std::string &hoveredTexture) : _hovered(false) {
+Button::Button(const std::string &defaultTexture, const std::string &hoveredTexture) :
+    _defaultTexture(CreateRef<Texture>(defaultTexture)),
+    _hoveredTexture(CreateRef<Texture>(hoveredTexture)),
+    _hovered(false) {
   _type = ButtonType::Textured;
 
-  auto it = _cachedTextures.find(defaultTexture);
-  if (it == _cachedTextures.end()) {
-    _defaultTexture = std::make_shared<Texture>(defaultTexture);
-    _cachedTextures.emplace(defaultTexture, _defaultTexture);
-  } else {
-    _defaultTexture = it->second;
-  }
-
-  auto it2 = _cachedTextures.find(hoveredTexture);
-  if (it2 == _cachedTextures.end()) {
-    _hoveredTexture = std::make_shared<Texture>(hoveredTexture);
-    _cachedTextures.emplace(hoveredTexture, _hoveredTexture);
-  } else {
-    _hoveredTexture = it2->second;
-  }
-
+  // NOTE: the images themselves are shared with every other button through the TextureRegistry
   _currentTexture = _defaultTexture;
   clientRect.h = _currentTexture->Height();
   clientRect.w = _currentTexture->Width();
@@ -67,13 +54,7 @@ Button::Button(const std::string &defaultTexture, const std::string &hoveredText
 
 Button::~Button() {
   CM_LOGGER_INFO("{} is being deleted", _componentId);
-  for (auto it = buttons.begin(); it != buttons.end();) {
-    if (it->first == _componentId) {
-      it = buttons.erase(it);
-    } else {
-      ++it;
-    }
-  }
+  buttons.erase(_componentId);
   for (auto e : _events) {
     e.second->RemoveAllListeners();
     delete e.second;
@@ -139,6 +120,7 @@ void Button::Render() {
   if (_type == ButtonType::Textured) {
     _currentTexture->Render(clientRect.y, clientRect.x, clientRect.h, clientRect.w);
   } else {
+    CoffeeMaker::Renderer::Flush();
     SDL_SetRenderDrawColor(CoffeeMaker::Renderer::Instance(), _currentColor.r, _currentColor.g, _currentColor.b,
                            _currentColor.a);
     SDL_RenderFillRect(CoffeeMaker::Renderer::Instance(), &clientRect);
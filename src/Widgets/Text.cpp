@@ -12,8 +12,7 @@ Text::Text() :
     color(CoffeeMaker::Color()),
     _textContent(""),
     _font(nullptr),
-    renderer(CoffeeMaker::Renderer::Instance()),
-    _texture(nullptr),
+    _glyphs(),
     _wrapLength(0) {
   _componentId = "CoffeeMaker::Widget::Text-" + std::to_string(++_textId);
 }
@@ -22,27 +21,15 @@ Text::Text(std::string textContent) :
     color(CoffeeMaker::Color()),
     _textContent(textContent),
     _font(nullptr),
-    renderer(CoffeeMaker::Renderer::Instance()),
-    _texture(nullptr),
+    _glyphs(),
     _wrapLength(0) {
   _componentId = "CoffeeMaker::Widget::Text-" + std::to_string(++_textId);
 }
 
-Text::~Text() {
-  if (_texture != nullptr) {
-    if (CoffeeMaker::Renderer::Exists()) {
-      // NOTE: destroy the current texture if the Renderer still exists
-      // we do this because SDL_DestroyRenderer will auto destroy all
-      // textures it created.
-      SDL_DestroyTexture(_texture);
-    }
-    _texture = nullptr;
-  }
-  _font = nullptr;
-}
+Text::~Text() { _font = nullptr; }
 
 void Text::OnAppend() {
-  SetTextContentTexture();
+  LayoutGlyphs();
   UIComponent::OnAppend();
 }
 
@@ -52,60 +39,45 @@ void Text::Render() {
                              "Cannot render Text because it has no assigned font!", nullptr);
     exit(1);
   }
-  if (_texture == nullptr) {
-    SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, "Text View : Render",
-                             "Cannot render Text because it has no assigned texture!", nullptr);
-    exit(1);
-  }
 
   // UIComponent::DebugRender(); NOTE: no debug rendering
-  SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-  SDL_RenderCopy(renderer, _texture, NULL, &clientRect);
-  CoffeeMaker::Renderer::IncDrawCalls();
+  const SDL_Color tint{color.r, color.g, color.b, color.a};
+  for (const CoffeeMaker::PlacedGlyph &glyph : _glyphs) {
+    SDL_FRect destination{static_cast<float>(clientRect.x) + glyph.destination.x,
+                          static_cast<float>(clientRect.y) + glyph.destination.y, glyph.destination.w,
+                          glyph.destination.h};
+    CoffeeMaker::Renderer::DrawSprite(glyph.texture, glyph.source, destination, 0.0, SDL_FLIP_NONE, tint);
+  }
 }
 
 void Text::SetFont(const std::string &fontName) {
   _font = FontManager::UseFont(fontName);
-  SetTextContentTexture();
+  LayoutGlyphs();
 }
 
 void Text::SetFont(const std::string &fontName, CoffeeMaker::FontManager::FontSize size) {
   _font = FontManager::UseFont(fontName, size);
-  SetTextContentTexture();
+  LayoutGlyphs();
 }
 
 void Text::SetFont(TTF_Font *f) {
   _font = f;
-  SetTextContentTexture();
+  LayoutGlyphs();
 }
 
 void Text::SetText(const std::string &textContent) {
+  if (textContent == _textContent) {
+    return;
+  }
   _textContent = textContent;
-  SetTextContentTexture();
+  LayoutGlyphs();
 }
 
-void Text::SetTextContentTexture() {
-  if (_font != nullptr && _textContent != "") {
-    SDL_Texture *oldTexture = _texture;
-    SDL_Texture *newTexture = nullptr;
-    SDL_Surface *surface = nullptr;
-    surface = TTF_RenderText_Blended_Wrapped(_font, _textContent.c_str(), color, GetWrapLength());
-    if (surface == nullptr) {
-      MessageBox::ShowMessageBoxAndQuit(
-          "Text Surface Error", "Could not create a text surface for the given string: \"" + _textContent + "\"");
-    }
-    newTexture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (newTexture == nullptr) {
-      MessageBox::ShowMessageBoxAndQuit(
-          "Text Surface Error", "Could not create a text texture for the given string: \"" + _textContent + "\"");
-    }
-    _texture = newTexture;
-    if (oldTexture != nullptr) {
-      SDL_DestroyTexture(oldTexture);
-    }
-    clientRect.w = surface->w;
-    clientRect.h = surface->h;
-    SDL_FreeSurface(surface);
+void Text::LayoutGlyphs() {
+  if (_font != nullptr) {
+    SDL_Point size = CoffeeMaker::GlyphAtlas::Layout(_font, _textContent, GetWrapLength(), _glyphs);
+    clientRect.w = size.x;
+    clientRect.h = size.y;
     CalcPosition();
   }
 }
@@ -115,12 +87,11 @@ void Text::SetColor(const SDL_Color &newColor) {
   color.g = newColor.g;
   color.b = newColor.b;
   color.a = newColor.a;
-  SetTextContentTexture();
 }
 
 void Text::SetWrapLength(Uint32 wrapLength) {
   _wrapLength = wrapLength;
-  SetTextContentTexture();
+  LayoutGlyphs();
 }
 
 std::string Text::ID() const { return _componentId; }
@@ -82,6 +82,7 @@ void UIComponent::DebugRender() {
   SDL_Color prevColor;
   SDL_Color borderColor = Color(200, 0, 200, 255);
 
+  Renderer::Flush();
   SDL_GetRenderDrawColor(Renderer::Instance(), &prevColor.r, &prevColor.g, &prevColor.b, &prevColor.a);
   SDL_SetRenderDrawColor(Renderer::Instance(), borderColor.r, borderColor.g, borderColor.b, borderColor.a);
   SDL_RenderDrawRect(Renderer::Instance(), &clientRect);
@@ -4,6 +4,10 @@
 #include <cppunit/TestAssert.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
 #include "Utilities.hpp"
 
 void CoffeeMakerBSpline::setUp() {
@@ -106,6 +110,120 @@ void CoffeeMakerBSpline::testSetBSplinePoint2DAtKnot() {
   CPPUNIT_ASSERT_EQUAL_MESSAGE("With negative domains", 1.0f, bSpline->Point2DAtKnot(-1.0).y);
 }
 
+void CoffeeMakerBSpline::testPoint2DAtKnotFollowsControlPoints() {
+  using Pt2 = CoffeeMaker::Math::Point2D;
+  Scope<CoffeeMaker::BSpline> bSpline = CreateScope<CoffeeMaker::BSpline>(6);
+  bSpline->SetControlPoints(std::vector<Pt2>{Pt2{.x = 0, .y = 0}, Pt2{.x = 100, .y = 50}, Pt2{.x = 200, .y = -30},
+                                             Pt2{.x = 300, .y = 80}, Pt2{.x = 400, .y = 10}, Pt2{.x = 500, .y = 90}});
+  bSpline->GenerateCurves(11);
+  std::vector<Pt2> samples = bSpline->GetPoints();
+
+  for (size_t i = 0; i < samples.size(); i++) {
+    Pt2 point = bSpline->Point2DAtKnot(i / 10.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(samples[i].x, point.x, 0.001);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(samples[i].y, point.y, 0.001);
+  }
+
+  // NOTE: moving a control point must not leave a stale copy behind
+  bSpline->SetControlPointAt(5, Pt2{.x = 600, .y = 90});
+  CPPUNIT_ASSERT_EQUAL(600.0f, bSpline->Point2DAtKnot(1.0).x);
+}
+
+void CoffeeMakerBSpline::testPoint2DAtDistanceMovesAtConstantSpeed() {
+  using Pt2 = CoffeeMaker::Math::Point2D;
+  Scope<CoffeeMaker::BSpline> bSpline = CreateScope<CoffeeMaker::BSpline>();
+  // NOTE: bunched up control points, by knot the curve crawls at the start and rushes at the end
+  bSpline->SetControlPoints(
+      std::vector<Pt2>{Pt2{.x = 0, .y = 0}, Pt2{.x = 1, .y = 0}, Pt2{.x = 2, .y = 0}, Pt2{.x = 100, .y = 0}});
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, bSpline->Length(), 0.01);
+  CPPUNIT_ASSERT(bSpline->Point2DAtKnot(0.5).x < 25.0f);
+
+  for (int i = 0; i <= 10; i++) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(i * 10.0, bSpline->Point2DAtDistance(i / 10.0f).x, 0.1);
+  }
+  CPPUNIT_ASSERT_EQUAL(0.0f, bSpline->Point2DAtDistance(-1.0f).x);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, bSpline->Point2DAtDistance(2.0f).x, 0.001);
+
+  // NOTE: the table must follow the control points
+  bSpline->SetControlPointAt(3, Pt2{.x = 200, .y = 0});
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(200.0, bSpline->Length(), 0.01);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, bSpline->Point2DAtDistance(0.5f).x, 0.1);
+}
+
+void CoffeeMakerBSpline::testBakedSplineAnchorsEachFollower() {
+  using Pt2 = CoffeeMaker::Math::Point2D;
+  Scope<CoffeeMaker::BSpline> bSpline = CreateScope<CoffeeMaker::BSpline>();
+  bSpline->SetControlPoints(
+      std::vector<Pt2>{Pt2{.x = 0, .y = 0}, Pt2{.x = 30, .y = 0}, Pt2{.x = 60, .y = 0}, Pt2{.x = 90, .y = 0}});
+  const CoffeeMaker::BakedSpline baked = bSpline->Bake(64);
+
+  // NOTE: later changes to the spline it was baked from must not reach the baked copy
+  bSpline->SetControlPointAt(3, Pt2{.x = 500, .y = 500});
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(90.0, baked.Length(), 0.01);
+  CPPUNIT_ASSERT_EQUAL(90.0f, baked.Last().x);
+
+  // NOTE: two followers anchored differently share the curve without seeing each other's anchors
+  Pt2 start = baked.Point2DAtDistance(0.0f, Pt2{.x = 10, .y = 20});
+  Pt2 end = baked.Point2DAtDistance(1.0f, Pt2{.x = 10, .y = 20});
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(10.0, start.x, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, start.y, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(90.0, end.x, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, end.y, 0.001);
+
+  Pt2 halfway = baked.Point2DAtDistance(0.5f, Pt2{.x = 0, .y = 0}, Pt2{.x = 0, .y = 100});
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(45.0, halfway.x, 0.1);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(50.0, halfway.y, 0.1);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(45.0, baked.Point2DAtDistance(0.5f).x, 0.1);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, baked.Point2DAtDistance(0.5f).y, 0.001);
+
+  const CoffeeMaker::BakedSpline inverted = baked.Invert(800.0f);
+  CPPUNIT_ASSERT_EQUAL(800.0f, inverted.First().x);
+  CPPUNIT_ASSERT_EQUAL(710.0f, inverted.Last().x);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(baked.Length(), inverted.Length(), 0.001);
+}
+
+void CoffeeMakerBSpline::testSplineAssetRoundTrip() {
+  using Pt2 = CoffeeMaker::Math::Point2D;
+  Scope<CoffeeMaker::BSpline> bSpline = CreateScope<CoffeeMaker::BSpline>();
+  bSpline->SetControlPoints(
+      std::vector<Pt2>{Pt2{.x = 0, .y = 0}, Pt2{.x = 30, .y = 40}, Pt2{.x = 60, .y = 40}, Pt2{.x = 90, .y = 0}});
+  CoffeeMaker::SplineAsset asset;
+  asset.controlPoints = bSpline->GetControlPoints();
+  for (tinyspline::real knot : bSpline->GetKnots()) {
+    asset.knots.push_back(static_cast<float>(knot));
+  }
+  asset.path = bSpline->Bake(32);
+
+  const std::string bytes = asset.Encode();
+  CoffeeMaker::SplineAsset decoded;
+  CPPUNIT_ASSERT(CoffeeMaker::SplineAsset::Decode(bytes.data(), bytes.size(), decoded));
+  CPPUNIT_ASSERT_EQUAL(asset.controlPoints.size(), decoded.controlPoints.size());
+  CPPUNIT_ASSERT_EQUAL(30.0f, decoded.controlPoints[1].x);
+  CPPUNIT_ASSERT(asset.knots == decoded.knots);
+  CPPUNIT_ASSERT(asset.path.Lengths() == decoded.path.Lengths());
+  CPPUNIT_ASSERT_EQUAL(asset.path.Last().x, decoded.path.Last().x);
+
+  // NOTE: anything cut short or of another version is turned away, decoded is left as it was
+  CPPUNIT_ASSERT(!CoffeeMaker::SplineAsset::Decode(bytes.data(), bytes.size() - 1, decoded));
+  std::string future = bytes;
+  future[4] = 2;
+  CPPUNIT_ASSERT(!CoffeeMaker::SplineAsset::Decode(future.data(), future.size(), decoded));
+  // NOTE: a count far past the end of the data is turned away before anything is allocated for it
+  std::string corrupt = bytes;
+  const std::uint32_t hugeCount = 0x7FFFFFFF;
+  std::memcpy(corrupt.data() + offsetof(CoffeeMaker::SplineAsset::Header, numSamples), &hugeCount, sizeof(hugeCount));
+  CPPUNIT_ASSERT(!CoffeeMaker::SplineAsset::Decode(corrupt.data(), corrupt.size(), decoded));
+  CPPUNIT_ASSERT(!CoffeeMaker::SplineAsset::Decode((bytes + "trailing").data(), bytes.size() + 8, decoded));
+  CPPUNIT_ASSERT_EQUAL(asset.path.Points().size(), decoded.path.Points().size());
+
+  // NOTE: a uniform stretch scales the lengths along, any other measures them again
+  const CoffeeMaker::BakedSpline doubled = decoded.path.Scale(2.0f, 2.0f);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(asset.path.Length() * 2.0, doubled.Length(), 0.001);
+  const CoffeeMaker::BakedSpline flattened = decoded.path.Scale(1.0f, 0.0f);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(90.0, flattened.Length(), 0.01);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(45.0, flattened.Point2DAtDistance(0.5f).x, 0.1);
+}
+
 void CoffeeMakerBSpline::testSetBSplinePointAddControlPoint() {
   using Pt2 = CoffeeMaker::Math::Point2D;
   Scope<CoffeeMaker::BSpline> bSpline = CreateScope<CoffeeMaker::BSpline>();
@@ -0,0 +1,82 @@
+#include "CoffeeMakerBenchmark.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <chrono>
+#include <thread>
+
+#include "InputManager.hpp"
+
+using namespace CoffeeMaker;
+
+void CoffeeMakerBenchmark::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerBenchmark::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerBenchmark::testPercentile() {
+  std::vector<double> samples;
+  for (int i = 1; i <= 100; i++) {
+    samples.push_back(static_cast<double>(i));
+  }
+
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(50.0, Benchmark::Percentile(samples, 50.0), 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(95.0, Benchmark::Percentile(samples, 95.0), 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(99.0, Benchmark::Percentile(samples, 99.0), 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, Benchmark::Percentile(samples, 0.0), 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, Benchmark::Percentile({}, 50.0), 0.0001);
+}
+
+void CoffeeMakerBenchmark::testSummarize() {
+  // NOTE: samples do not need to be sorted, one spike only shows up in the tail
+  BenchmarkStats stats = Benchmark::Summarize({4.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 30.0});
+
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0, stats.mean, 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, stats.p50, 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(30.0, stats.p95, 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(30.0, stats.max, 0.0001);
+}
+
+void CoffeeMakerBenchmark::testRecordsRequestedFrames() {
+  Benchmark benchmark("main", 3, 120.0);
+
+  for (int i = 0; i < 3; i++) {
+    CPPUNIT_ASSERT(benchmark.Running());
+    benchmark.BeginFrame();
+    {
+      BenchmarkStage stage(&benchmark, Benchmark::Stage::Update);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    benchmark.EndFrame(1);
+  }
+
+  CPPUNIT_ASSERT(!benchmark.Running());
+  CPPUNIT_ASSERT_EQUAL(3, benchmark.Frame());
+  CPPUNIT_ASSERT_EQUAL(static_cast<Uint32>(25), benchmark.SimulatedTicks());
+  const std::vector<double>& update = benchmark.StageTimes(Benchmark::Stage::Update);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), update.size());
+  for (double ms : update) {
+    CPPUNIT_ASSERT(ms >= 1.0);
+  }
+  // NOTE: stages that were never entered record nothing
+  for (double ms : benchmark.StageTimes(Benchmark::Stage::Physics)) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, ms, 0.0001);
+  }
+}
+
+void CoffeeMakerBenchmark::testScriptedInput() {
+  Benchmark benchmark("main", 1, 120.0);
+  InputManager::Init();
+
+  benchmark.ScriptInput();
+
+  CPPUNIT_ASSERT(InputManager::IsKeyDown(SDL_SCANCODE_RIGHT));
+  CPPUNIT_ASSERT(!InputManager::IsKeyDown(SDL_SCANCODE_LEFT));
+  CPPUNIT_ASSERT(InputManager::IsKeyPressed(SDL_SCANCODE_SPACE));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerBenchmark);
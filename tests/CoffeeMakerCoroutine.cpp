@@ -4,10 +4,17 @@
 #include <cppunit/TestAssert.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <chrono>
+#include <cstdlib>
 #include <filesystem>
+#include <iostream>
+#include <thread>
 
 #include "Coroutine.hpp"
+#include "CoroutineScheduler.hpp"
+#include "Executor.hpp"
 #include "File.hpp"
+#include "TimerWheel.hpp"
 
 void CoffeeMakerCoroutine::setUp() {
   // TODO: Implement set up logic...
@@ -41,16 +48,25 @@ void CoffeeMakerCoroutine::testCoroutineCreation() {
 
 void CoffeeMakerCoroutine::testCoroutineAwaiter() {
   using Co = CoffeeMaker::Coroutine;
+  bool resumed = false;
 
-  auto c = []() -> Co {
+  auto c = [&resumed]() -> Co {
     std::cout << "before awaiter" << std::endl;
     co_await CoffeeMaker::TimeoutAwaiter{1000};
     std::cout << "after awaiter" << std::endl;
+    resumed = true;
   };
 
   c();
   std::cout << "Return to caller\n";
-  std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+  CoffeeMaker::Async::TimerWheel::Instance()->Advance(999);
+  CoffeeMaker::Async::Executor::ProcessReady();
+  CPPUNIT_ASSERT(!resumed);
+
+  CoffeeMaker::Async::TimerWheel::Instance()->Advance(1);
+  CPPUNIT_ASSERT(!resumed);
+  CoffeeMaker::Async::Executor::ProcessReady();
+  CPPUNIT_ASSERT(resumed);
   std::cout << "Test complete\n";
 }
 
@@ -58,22 +74,97 @@ void CoffeeMakerCoroutine::testCoroutineReadFileAwaiter() {
   using Co = CoffeeMaker::Coroutine;
   std::string result;
   std::string expectedString = "Hello, World!";
+  std::thread::id mainThread = std::this_thread::get_id();
+  std::thread::id resumedOn;
 
-  auto c = [&result, &expectedString]() -> Co {
+  auto c = [&result, &expectedString, &resumedOn]() -> Co {
     std::cout << "before awaiter" << std::endl;
     co_await CoffeeMaker::WriteFileAwaiter{"testfile.txt", expectedString};
     CoffeeMaker::File file = co_await CoffeeMaker::ReadFileAwaiter{"testfile.txt"};
+    resumedOn = std::this_thread::get_id();
     std::cout << "after awaiter: " << file.data << std::endl;
     result = file.data;
+    free(file.data);
   };
 
   c();
   std::cout << "Return to caller\n";
-  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  // NOTE: the awaiters finish on the ThreadPool, the coroutine only moves on when the main thread drains the executor
+  for (int i = 0; i < 500 && result.empty(); i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    CoffeeMaker::Async::Executor::ProcessReady();
+  }
   std::cout << "Test complete\n";
   std::filesystem::remove("testfile.txt");
 
   CPPUNIT_ASSERT_EQUAL(expectedString, result);
+  CPPUNIT_ASSERT(mainThread == resumedOn);
+}
+
+void CoffeeMakerCoroutine::testDelayPausesWithTheTimerWheel() {
+  using Co = CoffeeMaker::Coroutine;
+  int steps = 0;
+
+  auto c = [&steps]() -> Co {
+    co_await CoffeeMaker::Delay(50);
+    steps++;
+    co_await CoffeeMaker::Delay(50);
+    steps++;
+  };
+
+  c();
+  CoffeeMaker::Async::TimerWheel::Instance()->Pause();
+  CoffeeMaker::Async::TimerWheel::Instance()->Update(0);
+  CoffeeMaker::Async::TimerWheel::Instance()->Update(1000);
+  CoffeeMaker::Async::Executor::ProcessReady();
+  CPPUNIT_ASSERT_EQUAL(0, steps);
+
+  CoffeeMaker::Async::TimerWheel::Instance()->Unpause();
+  CoffeeMaker::Async::TimerWheel::Instance()->Advance(50);
+  CoffeeMaker::Async::Executor::ProcessReady();
+  CPPUNIT_ASSERT_EQUAL(1, steps);
+  CoffeeMaker::Async::TimerWheel::Instance()->Advance(50);
+  CoffeeMaker::Async::Executor::ProcessReady();
+  CPPUNIT_ASSERT_EQUAL(2, steps);
+}
+
+void CoffeeMakerCoroutine::testClearCancelsDelay() {
+  using Co = CoffeeMaker::Coroutine;
+  CoffeeMaker::CoroutineScheduler scheduler;
+  bool resumed = false;
+
+  auto c = [&resumed, &scheduler]() -> Co {
+    co_await CoffeeMaker::TimeoutAwaiter{50, &scheduler};
+    resumed = true;
+  };
+
+  c();
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), scheduler.NumWaiting());
+  // NOTE: the resume is already posted when the scene goes away
+  CoffeeMaker::Async::TimerWheel::Instance()->Advance(50);
+  scheduler.Clear();
+  CoffeeMaker::Async::Executor::ProcessReady();
+  CPPUNIT_ASSERT(!resumed);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), scheduler.NumWaiting());
+}
+
+void CoffeeMakerCoroutine::testClearCancelsReadFile() {
+  using Co = CoffeeMaker::Coroutine;
+  bool resumed = false;
+  {
+    CoffeeMaker::CoroutineScheduler scheduler;
+    auto c = [&resumed, &scheduler]() -> Co {
+      co_await CoffeeMaker::ReadFileAwaiter{"testfile.txt", &scheduler};
+      resumed = true;
+    };
+    c();
+  }
+  // NOTE: the job outlives the scheduler and the coroutine, it only writes to the state it shares with the awaiter
+  for (int i = 0; i < 100; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    CoffeeMaker::Async::Executor::ProcessReady();
+  }
+  CPPUNIT_ASSERT(!resumed);
 }
 
 CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerCoroutine);
@@ -0,0 +1,120 @@
+#include "CoffeeMakerCoroutineScheduler.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Coroutine.hpp"
+
+using namespace CoffeeMaker;
+
+void CoffeeMakerCoroutineScheduler::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerCoroutineScheduler::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerCoroutineScheduler::testNextFrameResumesOnTheNextUpdate() {
+  CoroutineScheduler scheduler;
+  scheduler.MakeCurrent();
+  int frames = 0;
+
+  auto script = [&frames]() -> Coroutine {
+    while (frames < 3) {
+      co_await Await::NextFrame();
+      frames++;
+    }
+  };
+  script();
+
+  CPPUNIT_ASSERT_EQUAL(0, frames);
+  scheduler.Update(0.016f);
+  CPPUNIT_ASSERT_EQUAL(1, frames);
+  scheduler.Update(0.016f);
+  scheduler.Update(0.016f);
+  CPPUNIT_ASSERT_EQUAL(3, frames);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), scheduler.NumWaiting());
+}
+
+void CoffeeMakerCoroutineScheduler::testSecondsSkipsPausedTime() {
+  CoroutineScheduler scheduler;
+  scheduler.MakeCurrent();
+  bool done = false;
+
+  auto script = [&done]() -> Coroutine {
+    co_await Await::Seconds(1.0f);
+    done = true;
+  };
+  script();
+
+  scheduler.Update(0.5f);
+  scheduler.Pause();
+  scheduler.Update(5.0f);
+  CPPUNIT_ASSERT(!done);
+  CPPUNIT_ASSERT_EQUAL(0.5, scheduler.Time());
+
+  scheduler.Unpause();
+  scheduler.Update(0.25f);
+  CPPUNIT_ASSERT(!done);
+  scheduler.Update(0.25f);
+  CPPUNIT_ASSERT(done);
+}
+
+void CoffeeMakerCoroutineScheduler::testUntilAndEvent() {
+  CoroutineScheduler scheduler;
+  scheduler.MakeCurrent();
+  const Uint32 fire = SDL_USEREVENT + 1;
+  int target = 0;
+  bool ready = false;
+  Sint32 code = 0;
+
+  auto script = [&ready, &code, &target]() -> Coroutine {
+    co_await Await::Until([&ready]() { return ready; });
+    SDL_UserEvent event = co_await Await::Event(fire, &target);
+    code = event.code;
+  };
+  script();
+
+  scheduler.Update(0.016f);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), scheduler.NumWaiting());
+  ready = true;
+  scheduler.Update(0.016f);
+
+  SDL_UserEvent event{};
+  event.type = fire;
+  event.code = 7;
+  // NOTE: sent to someone else
+  scheduler.Dispatch(event);
+  CPPUNIT_ASSERT_EQUAL(0, code);
+  event.data1 = &target;
+  scheduler.Dispatch(event);
+  CPPUNIT_ASSERT_EQUAL(7, code);
+}
+
+void CoffeeMakerCoroutineScheduler::testClearDestroysWaitingScripts() {
+  struct Flag {
+    bool* destroyed;
+    ~Flag() { *destroyed = true; }
+  };
+  CoroutineScheduler scheduler;
+  scheduler.MakeCurrent();
+  bool destroyed = false;
+  bool finished = false;
+
+  auto script = [&destroyed, &finished]() -> Coroutine {
+    Flag flag{&destroyed};
+    co_await Await::Seconds(10.0f);
+    finished = true;
+  };
+  script();
+
+  CPPUNIT_ASSERT(!destroyed);
+  scheduler.Clear();
+  CPPUNIT_ASSERT(destroyed);
+  scheduler.Update(20.0f);
+  CPPUNIT_ASSERT(!finished);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), scheduler.NumWaiting());
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerCoroutineScheduler);
@@ -0,0 +1,123 @@
+#include "CoffeeMakerECS.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <vector>
+
+using namespace CoffeeMaker::ECS;
+
+namespace {
+  struct Position {
+    float x;
+    float y;
+  };
+
+  struct Health {
+    int points;
+  };
+}  // namespace
+
+void CoffeeMakerECS::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerECS::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerECS::testDestroyedHandlesStopResolving() {
+  World world;
+  Handle first = world.Create();
+  world.Add<Position>(first, 1.0f, 2.0f);
+  CPPUNIT_ASSERT(world.IsAlive(first));
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), world.NumAlive());
+
+  world.Destroy(first);
+  CPPUNIT_ASSERT(!world.IsAlive(first));
+  CPPUNIT_ASSERT(world.Get<Position>(first) == nullptr);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), world.NumAlive());
+
+  // NOTE: the index is reused under a new generation, the old handle must not see the new entity's components
+  Handle second = world.Create();
+  world.Add<Position>(second, 3.0f, 4.0f);
+  CPPUNIT_ASSERT_EQUAL(first.index, second.index);
+  CPPUNIT_ASSERT(first != second);
+  CPPUNIT_ASSERT(world.Get<Position>(first) == nullptr);
+  CPPUNIT_ASSERT_EQUAL(3.0f, world.Get<Position>(second)->x);
+
+  world.Destroy(first);
+  CPPUNIT_ASSERT(world.IsAlive(second));
+
+  world.Clear();
+  CPPUNIT_ASSERT(!world.IsAlive(second));
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), world.Pool<Position>().Size());
+}
+
+void CoffeeMakerECS::testRemovingKeepsComponentsPacked() {
+  World world;
+  std::vector<Handle> handles;
+  for (int i = 0; i < 4; i++) {
+    handles.push_back(world.Create());
+    world.Add<Health>(handles.back(), i);
+  }
+
+  world.Remove<Health>(handles[1]);
+  ComponentPool<Health>& pool = world.Pool<Health>();
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), pool.Size());
+  CPPUNIT_ASSERT(!world.Has<Health>(handles[1]));
+  CPPUNIT_ASSERT(world.IsAlive(handles[1]));
+  // NOTE: the last component was moved into the freed slot and can still be found through its handle
+  CPPUNIT_ASSERT(pool.Handles()[1] == handles[3]);
+  CPPUNIT_ASSERT_EQUAL(3, world.Get<Health>(handles[3])->points);
+  CPPUNIT_ASSERT_EQUAL(0, world.Get<Health>(handles[0])->points);
+  CPPUNIT_ASSERT_EQUAL(2, world.Get<Health>(handles[2])->points);
+}
+
+void CoffeeMakerECS::testEachVisitsEntitiesWithBothComponents() {
+  World world;
+  Handle moving = world.Create();
+  world.Add<Position>(moving, 0.0f, 0.0f);
+  world.Add<Health>(moving, 10);
+  Handle still = world.Create();
+  world.Add<Position>(still, 5.0f, 5.0f);
+  Handle ghost = world.Create();
+  world.Add<Health>(ghost, 1);
+
+  int visited = 0;
+  world.Each<Position, Health>([&visited, moving](Handle handle, Position& position, Health& health) {
+    CPPUNIT_ASSERT(handle == moving);
+    position.x += static_cast<float>(health.points);
+    visited++;
+  });
+  CPPUNIT_ASSERT_EQUAL(1, visited);
+  CPPUNIT_ASSERT_EQUAL(10.0f, world.Get<Position>(moving)->x);
+  CPPUNIT_ASSERT_EQUAL(5.0f, world.Get<Position>(still)->x);
+
+  visited = 0;
+  world.Each<Position>([&visited](Handle, Position&) { visited++; });
+  CPPUNIT_ASSERT_EQUAL(2, visited);
+}
+
+void CoffeeMakerECS::testDestroyWhileIteratingIsDeferred() {
+  World world;
+  for (int i = 0; i < 5; i++) {
+    world.Add<Health>(world.Create(), i);
+  }
+
+  int visited = 0;
+  world.Each<Health>([&world, &visited](Handle handle, Health& health) {
+    visited++;
+    if (health.points % 2 == 0) {
+      world.Destroy(handle);
+      // NOTE: still alive until the system is done, so the rest of the pool does not move underneath it
+      CPPUNIT_ASSERT(world.IsAlive(handle));
+    }
+  });
+  CPPUNIT_ASSERT_EQUAL(5, visited);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), world.NumAlive());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), world.Pool<Health>().Size());
+  world.Each<Health>([](Handle, Health& health) { CPPUNIT_ASSERT(health.points % 2 == 1); });
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerECS);
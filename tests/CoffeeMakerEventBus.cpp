@@ -0,0 +1,118 @@
+#include "CoffeeMakerEventBus.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <vector>
+
+using namespace CoffeeMaker;
+
+namespace {
+  const Uint32 FIRST_TYPE = SDL_USEREVENT + 1;
+  const Uint32 SECOND_TYPE = SDL_USEREVENT + 2;
+
+  SDL_UserEvent MakeEvent(Uint32 type, void* data1 = nullptr) {
+    return SDL_UserEvent{.type = type, .timestamp = 0, .windowID = 0, .code = -1, .data1 = data1, .data2 = nullptr};
+  }
+}  // namespace
+
+void CoffeeMakerEventBus::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerEventBus::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerEventBus::testEventsAreDeliveredOnDispatch() {
+  EventBus bus;
+  int first = 0;
+  int second = 0;
+  int all = 0;
+  EventSubscription a = bus.Subscribe(FIRST_TYPE, [&first](const SDL_UserEvent&) { first++; });
+  EventSubscription b = bus.Subscribe(SECOND_TYPE, [&second](const SDL_UserEvent&) { second++; });
+  EventSubscription c = bus.SubscribeAll([&all](const SDL_UserEvent&) { all++; });
+
+  bus.Publish(MakeEvent(FIRST_TYPE));
+  bus.Publish(MakeEvent(FIRST_TYPE));
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), bus.NumQueued());
+  CPPUNIT_ASSERT_EQUAL(0, first);
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), bus.Dispatch());
+  CPPUNIT_ASSERT_EQUAL(2, first);
+  CPPUNIT_ASSERT_EQUAL(0, second);
+  CPPUNIT_ASSERT_EQUAL(2, all);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), bus.NumQueued());
+
+  a.Reset();
+  bus.Publish(MakeEvent(FIRST_TYPE));
+  bus.Dispatch();
+  CPPUNIT_ASSERT_EQUAL(2, first);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), bus.NumSubscribers(FIRST_TYPE));
+}
+
+void CoffeeMakerEventBus::testRoutedEventsOnlyReachTheirTarget() {
+  EventBus bus;
+  int targets[3] = {0, 0, 0};
+  int broadcast = 0;
+  EventSubscriptions subscriptions;
+  for (int& target : targets) {
+    subscriptions.push_back(bus.Subscribe(FIRST_TYPE, &target, [&target](const SDL_UserEvent&) { target++; }));
+  }
+  subscriptions.push_back(bus.Subscribe(FIRST_TYPE, [&broadcast](const SDL_UserEvent&) { broadcast++; }));
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), bus.NumSubscribers(FIRST_TYPE));
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), bus.NumSubscribers(FIRST_TYPE, &targets[1]));
+
+  bus.Publish(MakeEvent(FIRST_TYPE, &targets[1]));
+  bus.Publish(MakeEvent(FIRST_TYPE));
+  bus.Dispatch();
+
+  CPPUNIT_ASSERT_EQUAL(0, targets[0]);
+  CPPUNIT_ASSERT_EQUAL(1, targets[1]);
+  CPPUNIT_ASSERT_EQUAL(0, targets[2]);
+  CPPUNIT_ASSERT_EQUAL(2, broadcast);
+
+  subscriptions.clear();
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), bus.NumSubscribers(FIRST_TYPE));
+}
+
+void CoffeeMakerEventBus::testEventsPublishedWhileDispatchingWaitAFrame() {
+  EventBus bus;
+  std::vector<Uint32> received;
+  EventSubscription forward = bus.Subscribe(FIRST_TYPE, [&bus, &received](const SDL_UserEvent& event) {
+    received.push_back(event.type);
+    bus.Publish(MakeEvent(SECOND_TYPE));
+  });
+  EventSubscription record =
+      bus.Subscribe(SECOND_TYPE, [&received](const SDL_UserEvent& event) { received.push_back(event.type); });
+
+  bus.Publish(MakeEvent(FIRST_TYPE));
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), bus.Dispatch());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), received.size());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), bus.NumQueued());
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), bus.Dispatch());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), received.size());
+  CPPUNIT_ASSERT_EQUAL(SECOND_TYPE, received[1]);
+}
+
+void CoffeeMakerEventBus::testUnsubscribeWhileDispatching() {
+  EventBus bus;
+  int calls = 0;
+  EventSubscriptions subscriptions;
+  // NOTE: the first handler drops every subscription, its own included, the second must not run
+  subscriptions.push_back(bus.Subscribe(FIRST_TYPE, [&subscriptions, &calls](const SDL_UserEvent&) {
+    calls++;
+    subscriptions.clear();
+  }));
+  subscriptions.push_back(bus.Subscribe(FIRST_TYPE, [&calls](const SDL_UserEvent&) { calls++; }));
+
+  bus.Publish(MakeEvent(FIRST_TYPE));
+  bus.Publish(MakeEvent(FIRST_TYPE));
+  bus.Dispatch();
+
+  CPPUNIT_ASSERT_EQUAL(1, calls);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), bus.NumSubscribers(FIRST_TYPE));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerEventBus);
@@ -0,0 +1,65 @@
+#include "CoffeeMakerFixedTimestep.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+using namespace CoffeeMaker;
+
+void CoffeeMakerFixedTimestep::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerFixedTimestep::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerFixedTimestep::testAccumulatesWholeSteps() {
+  FixedTimestep simulation(100.0);
+
+  CPPUNIT_ASSERT_EQUAL(0, simulation.Accumulate(0.004));
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.4, simulation.Alpha(), 0.0001);
+  CPPUNIT_ASSERT_EQUAL(1, simulation.Accumulate(0.0075));
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.15, simulation.Alpha(), 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.01, simulation.DeltaTime(), 0.000001);
+}
+
+void CoffeeMakerFixedTimestep::testSpikeIsSplitIntoSteps() {
+  FixedTimestep simulation(120.0);
+
+  // NOTE: a 50ms hitch is simulated as six 1/120s steps rather than one long one
+  CPPUNIT_ASSERT_EQUAL(6, simulation.Accumulate(0.05));
+  CPPUNIT_ASSERT_EQUAL(static_cast<Uint64>(0), simulation.DroppedSteps());
+}
+
+void CoffeeMakerFixedTimestep::testStepsAreCapped() {
+  FixedTimestep simulation(100.0, 4);
+
+  CPPUNIT_ASSERT_EQUAL(4, simulation.Accumulate(0.105));
+  CPPUNIT_ASSERT_EQUAL(static_cast<Uint64>(6), simulation.DroppedSteps());
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, simulation.Alpha(), 0.0001);
+  CPPUNIT_ASSERT_EQUAL(0, simulation.Accumulate(0.001));
+}
+
+void CoffeeMakerFixedTimestep::testInterpolatedPoint() {
+  FixedTimestep simulation(100.0);
+  simulation.MakeCurrent();
+  InterpolatedPoint point;
+  point.Reset(0.0f, 0.0f);
+
+  simulation.Accumulate(0.01);
+  simulation.Step();
+  point.Update(10.0f, 20.0f);
+  simulation.Accumulate(0.0025);
+
+  SDL_FPoint blended = point.Get();
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(2.5, blended.x, 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0, blended.y, 0.0001);
+
+  // NOTE: not moved in the latest step, so it renders where it is
+  simulation.Step();
+  SDL_FPoint resting = point.Get();
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(10.0, resting.x, 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, resting.y, 0.0001);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerFixedTimestep);
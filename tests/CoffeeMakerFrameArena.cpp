@@ -0,0 +1,78 @@
+#include "CoffeeMakerFrameArena.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cstdint>
+
+#include "Memory.hpp"
+
+using namespace CoffeeMaker;
+
+void CoffeeMakerFrameArena::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerFrameArena::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerFrameArena::testAllocationsAreAligned() {
+  FrameArena arena(1024);
+
+  char* c = arena.New<char>('a');
+  double* d = arena.New<double>(2.5);
+  void* wide = arena.Allocate(16, 64);
+
+  CPPUNIT_ASSERT_EQUAL('a', *c);
+  CPPUNIT_ASSERT_EQUAL(2.5, *d);
+  CPPUNIT_ASSERT_EQUAL(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(d) % alignof(double));
+  CPPUNIT_ASSERT_EQUAL(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(wide) % 64);
+  CPPUNIT_ASSERT(arena.Used() >= sizeof(char) + sizeof(double) + 16);
+}
+
+void CoffeeMakerFrameArena::testResetReusesMemory() {
+  FrameArena arena(1024);
+
+  int* first = arena.NewArray<int>(16);
+  arena.Reset();
+  int* second = arena.NewArray<int>(16);
+
+  CPPUNIT_ASSERT(first == second);
+  CPPUNIT_ASSERT_EQUAL(sizeof(int) * 16, arena.HighWater());
+}
+
+void CoffeeMakerFrameArena::testOverflowGrowsOnReset() {
+  FrameArena arena(64);
+
+  // NOTE: the frame still gets its memory when the arena is full
+  CPPUNIT_ASSERT(arena.Allocate(48) != nullptr);
+  CPPUNIT_ASSERT(arena.Allocate(48) != nullptr);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), arena.Overflows());
+
+  arena.Reset();
+  CPPUNIT_ASSERT(arena.Capacity() >= 96);
+
+  // NOTE: a frame of the same size now fits and does not touch the heap
+  std::uint64_t allocations = Memory::Allocations();
+  CPPUNIT_ASSERT(arena.Allocate(48) != nullptr);
+  CPPUNIT_ASSERT(arena.Allocate(48) != nullptr);
+  CPPUNIT_ASSERT_EQUAL(allocations, Memory::Allocations());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), arena.Overflows());
+}
+
+void CoffeeMakerFrameArena::testArenaAllocator() {
+  FrameArena arena(4096);
+  std::uint64_t allocations = Memory::Allocations();
+
+  std::vector<int, ArenaAllocator<int>> numbers{ArenaAllocator<int>(&arena)};
+  for (int i = 0; i < 100; i++) {
+    numbers.push_back(i);
+  }
+
+  CPPUNIT_ASSERT_EQUAL(99, numbers.back());
+  CPPUNIT_ASSERT_EQUAL(allocations, Memory::Allocations());
+  CPPUNIT_ASSERT(arena.Used() >= sizeof(int) * 100);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerFrameArena);
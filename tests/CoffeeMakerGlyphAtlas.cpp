@@ -0,0 +1,78 @@
+#include "CoffeeMakerGlyphAtlas.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <string>
+#include <vector>
+
+using namespace CoffeeMaker;
+
+void CoffeeMakerGlyphAtlas::setUp() {
+  // NOTE: a monospaced font, every glyph is 10px wide
+  for (int& advance : _advances) {
+    advance = 10;
+  }
+}
+
+void CoffeeMakerGlyphAtlas::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerGlyphAtlas::testBreakLinesWithoutWrapLength() {
+  std::vector<GlyphAtlas::Line> lines;
+  GlyphAtlas::BreakLines("Score: 1000", _advances, 0, lines);
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lines.size());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lines[0].begin);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(11), lines[0].end);
+  CPPUNIT_ASSERT_EQUAL(110, lines[0].width);
+
+  GlyphAtlas::BreakLines("", _advances, 0, lines);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lines.size());
+  CPPUNIT_ASSERT_EQUAL(0, lines[0].width);
+}
+
+void CoffeeMakerGlyphAtlas::testBreakLinesAtNewlines() {
+  std::vector<GlyphAtlas::Line> lines;
+  GlyphAtlas::BreakLines("ab\ncde\n", _advances, 0, lines);
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lines.size());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lines[0].begin);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lines[0].end);
+  CPPUNIT_ASSERT_EQUAL(20, lines[0].width);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lines[1].begin);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(6), lines[1].end);
+  CPPUNIT_ASSERT_EQUAL(30, lines[1].width);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), lines[2].begin);
+  CPPUNIT_ASSERT_EQUAL(0, lines[2].width);
+}
+
+void CoffeeMakerGlyphAtlas::testBreakLinesWrapsAtLastSpace() {
+  const std::string text = "lorem ipsum dolor sit";
+  std::vector<GlyphAtlas::Line> lines;
+  GlyphAtlas::BreakLines(text, _advances, 120, lines);
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lines.size());
+  CPPUNIT_ASSERT_EQUAL(std::string("lorem ipsum"), text.substr(lines[0].begin, lines[0].end - lines[0].begin));
+  CPPUNIT_ASSERT_EQUAL(110, lines[0].width);
+  CPPUNIT_ASSERT_EQUAL(std::string("dolor sit"), text.substr(lines[1].begin, lines[1].end - lines[1].begin));
+  CPPUNIT_ASSERT_EQUAL(90, lines[1].width);
+  for (const GlyphAtlas::Line& line : lines) {
+    CPPUNIT_ASSERT(line.width <= 120);
+  }
+}
+
+void CoffeeMakerGlyphAtlas::testBreakLinesSplitsLongWords() {
+  const std::string text = "abcdefgh";
+  std::vector<GlyphAtlas::Line> lines;
+  GlyphAtlas::BreakLines(text, _advances, 30, lines);
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lines.size());
+  CPPUNIT_ASSERT_EQUAL(std::string("abc"), text.substr(lines[0].begin, lines[0].end - lines[0].begin));
+  CPPUNIT_ASSERT_EQUAL(std::string("def"), text.substr(lines[1].begin, lines[1].end - lines[1].begin));
+  CPPUNIT_ASSERT_EQUAL(std::string("gh"), text.substr(lines[2].begin, lines[2].end - lines[2].begin));
+  CPPUNIT_ASSERT_EQUAL(20, lines[2].width);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerGlyphAtlas);
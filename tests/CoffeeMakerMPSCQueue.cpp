@@ -0,0 +1,110 @@
+#include "CoffeeMakerMPSCQueue.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <thread>
+#include <vector>
+
+using namespace CoffeeMaker::Async;
+
+void CoffeeMakerMPSCQueue::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerMPSCQueue::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerMPSCQueue::testPushAndPopInOrder() {
+  MPSCQueue<int> queue(6);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), queue.Capacity());
+
+  for (int i = 0; i < 5; i++) {
+    CPPUNIT_ASSERT(queue.TryPush(i));
+  }
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), queue.Size());
+
+  int value = -1;
+  for (int i = 0; i < 5; i++) {
+    CPPUNIT_ASSERT(queue.TryPop(value));
+    CPPUNIT_ASSERT_EQUAL(i, value);
+  }
+  CPPUNIT_ASSERT(!queue.TryPop(value));
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), queue.HighWater());
+}
+
+void CoffeeMakerMPSCQueue::testFullRingSpillsIntoOverflow() {
+  MPSCQueue<int> queue(4);
+  for (int i = 0; i < 4; i++) {
+    CPPUNIT_ASSERT(queue.TryPush(i));
+  }
+  CPPUNIT_ASSERT(!queue.TryPush(4));
+
+  queue.Push(4);
+  queue.Push(5);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), queue.Overflows());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), queue.HighWater());
+
+  std::vector<int> drained;
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(6), queue.Drain([&drained](int&& value) { drained.push_back(value); }));
+  for (int i = 0; i < 6; i++) {
+    CPPUNIT_ASSERT_EQUAL(i, drained[static_cast<size_t>(i)]);
+  }
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), queue.Size());
+}
+
+void CoffeeMakerMPSCQueue::testDrainLeavesMessagesPushedWhileDraining() {
+  MPSCQueue<int> queue(8);
+  queue.Push(1);
+  queue.Push(2);
+
+  size_t drained = queue.Drain([&queue](int&& value) { queue.Push(value * 10); });
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), drained);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), queue.Size());
+
+  int value = 0;
+  CPPUNIT_ASSERT(queue.TryPop(value));
+  CPPUNIT_ASSERT_EQUAL(10, value);
+  CPPUNIT_ASSERT(queue.TryPop(value));
+  CPPUNIT_ASSERT_EQUAL(20, value);
+}
+
+void CoffeeMakerMPSCQueue::testManyProducers() {
+  const int producers = 4;
+  const int perProducer = 5000;
+  // NOTE: smaller than what is pushed, so producers run into a full ring and spill while the consumer drains
+  MPSCQueue<int> queue(256);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&queue, p]() {
+      for (int i = 0; i < perProducer; i++) {
+        queue.Push(p * perProducer + i);
+      }
+    });
+  }
+
+  std::vector<int> last(producers, -1);
+  bool ordered = true;
+  size_t received = 0;
+  auto consume = [&](int&& value) {
+    const int producer = value / perProducer;
+    ordered = ordered && value > last[static_cast<size_t>(producer)];
+    last[static_cast<size_t>(producer)] = value;
+    received++;
+  };
+  while (received < static_cast<size_t>(producers * perProducer)) {
+    queue.Drain(consume);
+    std::this_thread::yield();
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(producers * perProducer), received);
+  CPPUNIT_ASSERT(ordered);
+  CPPUNIT_ASSERT(queue.HighWater() <= queue.Capacity());
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerMPSCQueue);
@@ -0,0 +1,103 @@
+#include "CoffeeMakerProfiler.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <thread>
+
+using namespace CoffeeMaker;
+
+namespace {
+  const char* OUTER = "Outer";
+  const char* INNER = "Inner";
+  const char* WORKER = "Worker";
+
+  const ZoneStats* FindZone(const char* name) {
+    for (const ZoneStats& zone : Profiler::LastFrame()) {
+      if (zone.name == name) {
+        return &zone;
+      }
+    }
+    return nullptr;
+  }
+}  // namespace
+
+void CoffeeMakerProfiler::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerProfiler::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerProfiler::testNestedZonesAreAggregated() {
+  Profiler::Reset();
+  {
+    ProfileZone outer(OUTER);
+    for (int i = 0; i < 2; i++) {
+      ProfileZone inner(INNER);
+    }
+  }
+  Profiler::EndFrame();
+
+  const ZoneStats* outer = FindZone(OUTER);
+  const ZoneStats* inner = FindZone(INNER);
+  CPPUNIT_ASSERT(outer != nullptr);
+  CPPUNIT_ASSERT(inner != nullptr);
+  CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(1), outer->calls);
+  CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0), outer->depth);
+  CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(2), inner->calls);
+  CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(1), inner->depth);
+  CPPUNIT_ASSERT(outer->totalNs >= inner->totalNs);
+
+  // NOTE: each frame starts from nothing
+  Profiler::EndFrame();
+  CPPUNIT_ASSERT(Profiler::LastFrame().empty());
+}
+
+void CoffeeMakerProfiler::testZonesFromOtherThreads() {
+  Profiler::Reset();
+  std::thread worker([] { ProfileZone zone(WORKER); });
+  worker.join();
+  Profiler::EndFrame();
+
+  const ZoneStats* zone = FindZone(WORKER);
+  CPPUNIT_ASSERT(zone != nullptr);
+  CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(1), zone->calls);
+}
+
+void CoffeeMakerProfiler::testFullRingDropsEvents() {
+  auto buffer = std::make_unique<ProfileBuffer>(0);
+  ProfileEvent event{.name = INNER, .start = 0, .end = 1, .depth = 0, .thread = 0};
+  for (size_t i = 0; i < ProfileBuffer::CAPACITY; i++) {
+    CPPUNIT_ASSERT(buffer->Push(event));
+  }
+  CPPUNIT_ASSERT(!buffer->Push(event));
+  CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(1), buffer->Dropped());
+
+  size_t drained = 0;
+  buffer->Drain([&drained](const ProfileEvent&) { drained++; });
+  CPPUNIT_ASSERT_EQUAL(ProfileBuffer::CAPACITY, drained);
+  CPPUNIT_ASSERT(buffer->Push(event));
+}
+
+void CoffeeMakerProfiler::testChromeTrace() {
+  Profiler::Reset();
+  Profiler::StartCapture();
+  Profiler::EndFrame();
+  {
+    ProfileZone outer(OUTER);
+  }
+  Profiler::EndFrame();
+  Profiler::StopCapture();
+
+  // NOTE: the zone and the frame it closed in
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), Profiler::NumCapturedEvents());
+  std::string trace = Profiler::ChromeTrace();
+  CPPUNIT_ASSERT(trace.find("\"traceEvents\"") != std::string::npos);
+  CPPUNIT_ASSERT(trace.find("\"name\": \"Outer\", \"ph\": \"X\"") != std::string::npos);
+  CPPUNIT_ASSERT(trace.find("\"name\": \"Frame\"") != std::string::npos);
+  Profiler::Reset();
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerProfiler);
@@ -0,0 +1,54 @@
+#include "CoffeeMakerRenderer.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cstring>
+
+using namespace CoffeeMaker;
+
+void CoffeeMakerRenderer::setUp() {
+  std::memset(_handle, 0, sizeof(_handle));
+  const TextureModulation modulation{.color = {255, 255, 255, 255}, .alpha = 255, .blendMode = SDL_BLENDMODE_BLEND};
+  // NOTE: not adopted, releasing it must not reach SDL_DestroyTexture
+  _asset = Ref<TextureAsset>(new TextureAsset{.handle = reinterpret_cast<SDL_Texture*>(_handle),
+                                              .width = 16,
+                                              .height = 16,
+                                              .base = modulation,
+                                              .applied = modulation});
+}
+
+void CoffeeMakerRenderer::tearDown() {
+  Renderer::Flush();
+  _asset = nullptr;
+}
+
+void CoffeeMakerRenderer::testOpaqueSpriteQueuesWhiteVertices() {
+  Texture texture(_asset);
+  texture.Render(0, 0);
+
+  const std::vector<SDL_Vertex>& vertices = Renderer::QueuedVertices();
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), vertices.size());
+  for (const SDL_Vertex& vertex : vertices) {
+    CPPUNIT_ASSERT_EQUAL(255, static_cast<int>(vertex.color.r));
+    CPPUNIT_ASSERT_EQUAL(255, static_cast<int>(vertex.color.a));
+  }
+}
+
+void CoffeeMakerRenderer::testTranslucentSpriteQueuesTintedVertices() {
+  Texture texture(_asset);
+  texture.SetColor(SDL_Color{255, 0, 128, 255});
+  texture.SetAlpha(64);
+  texture.Render(SDL_Rect{0, 0, 16, 16}, SDL_FRect{10.0f, 10.0f, 16.0f, 16.0f}, 90.0, SDL_FLIP_HORIZONTAL);
+
+  const std::vector<SDL_Vertex>& vertices = Renderer::QueuedVertices();
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), vertices.size());
+  for (const SDL_Vertex& vertex : vertices) {
+    CPPUNIT_ASSERT_EQUAL(255, static_cast<int>(vertex.color.r));
+    CPPUNIT_ASSERT_EQUAL(0, static_cast<int>(vertex.color.g));
+    CPPUNIT_ASSERT_EQUAL(128, static_cast<int>(vertex.color.b));
+    CPPUNIT_ASSERT_EQUAL(64, static_cast<int>(vertex.color.a));
+  }
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerRenderer);
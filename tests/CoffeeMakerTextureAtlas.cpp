@@ -0,0 +1,70 @@
+#include "CoffeeMakerTextureAtlas.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <vector>
+
+using namespace CoffeeMaker;
+
+void CoffeeMakerTextureAtlas::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerTextureAtlas::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerTextureAtlas::testPackedRegionsDoNotOverlap() {
+  const int pageSize = 256;
+  const int padding = 1;
+  std::vector<SDL_Point> sizes{{32, 32}, {64, 96}, {100, 100}, {16, 16}, {64, 64}, {150, 50}, {96, 96}, {16, 16}};
+  std::vector<TextureAtlas::Placement> placements = TextureAtlas::Pack(sizes, pageSize, padding);
+
+  CPPUNIT_ASSERT_EQUAL(sizes.size(), placements.size());
+  for (size_t i = 0; i < sizes.size(); i++) {
+    const TextureAtlas::Placement& a = placements[i];
+    CPPUNIT_ASSERT(a.page >= 0);
+    CPPUNIT_ASSERT(a.x - padding >= 0 && a.y - padding >= 0);
+    CPPUNIT_ASSERT(a.x + sizes[i].x + padding <= pageSize);
+    CPPUNIT_ASSERT(a.y + sizes[i].y + padding <= pageSize);
+    for (size_t j = i + 1; j < sizes.size(); j++) {
+      const TextureAtlas::Placement& b = placements[j];
+      if (a.page != b.page) {
+        continue;
+      }
+      // NOTE: padded rects may touch but never overlap
+      bool overlaps = a.x - padding < b.x + sizes[j].x + padding && b.x - padding < a.x + sizes[i].x + padding &&
+                      a.y - padding < b.y + sizes[j].y + padding && b.y - padding < a.y + sizes[i].y + padding;
+      CPPUNIT_ASSERT(!overlaps);
+    }
+  }
+}
+
+void CoffeeMakerTextureAtlas::testOversizedImagesAreSkipped() {
+  std::vector<SDL_Point> sizes{{32, 32}, {128, 20}, {20, 126}};
+  std::vector<TextureAtlas::Placement> placements = TextureAtlas::Pack(sizes, 128, 1);
+
+  CPPUNIT_ASSERT_EQUAL(0, placements[0].page);
+  CPPUNIT_ASSERT_EQUAL(-1, placements[1].page);
+  CPPUNIT_ASSERT_EQUAL(0, placements[2].page);
+}
+
+void CoffeeMakerTextureAtlas::testOverflowStartsNewPage() {
+  std::vector<SDL_Point> sizes(5, SDL_Point{62, 62});
+  std::vector<TextureAtlas::Placement> placements = TextureAtlas::Pack(sizes, 128, 1);
+
+  int pageCounts[2] = {0, 0};
+  for (const TextureAtlas::Placement& placement : placements) {
+    CPPUNIT_ASSERT(placement.page == 0 || placement.page == 1);
+    pageCounts[placement.page]++;
+  }
+  CPPUNIT_ASSERT_EQUAL(4, pageCounts[0]);
+  CPPUNIT_ASSERT_EQUAL(1, pageCounts[1]);
+}
+
+void CoffeeMakerTextureAtlas::testFindUnknownName() {
+  CPPUNIT_ASSERT(TextureAtlas::Find("DoesNotExist.png") == nullptr);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerTextureAtlas);
@@ -0,0 +1,71 @@
+#include "CoffeeMakerThreadPool.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <atomic>
+#include <vector>
+
+#include "Async.hpp"
+
+using namespace CoffeeMaker::Async;
+
+void CoffeeMakerThreadPool::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerThreadPool::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerThreadPool::testEnqueueReturnsResult() {
+  ThreadPool pool(2);
+
+  std::future<int> sum = pool.Enqueue([](int a, int b) { return a + b; }, 2, 3);
+  std::future<bool> onWorker = pool.Enqueue([&pool]() { return pool.IsWorker(); });
+
+  CPPUNIT_ASSERT_EQUAL(5, sum.get());
+  CPPUNIT_ASSERT(onWorker.get());
+  CPPUNIT_ASSERT(!pool.IsWorker());
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), pool.NumWorkers());
+}
+
+void CoffeeMakerThreadPool::testParallelForVisitsEveryIndexOnce() {
+  ThreadPool pool(3);
+  std::vector<std::atomic<int>> visits(1000);
+
+  pool.ParallelFor(0, visits.size(), 7, [&visits](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      visits[i]++;
+    }
+  });
+
+  for (const std::atomic<int>& count : visits) {
+    CPPUNIT_ASSERT_EQUAL(1, count.load());
+  }
+}
+
+void CoffeeMakerThreadPool::testNestedWaitDoesNotDeadlock() {
+  // NOTE: a single worker has to run the inner jobs itself while its outer job waits on them
+  ThreadPool pool(1);
+
+  std::future<int> outer = pool.Enqueue([&pool]() {
+    std::future<int> inner = pool.Enqueue([]() { return 20; });
+    pool.Wait(inner);
+    std::atomic<int> sum = 0;
+    pool.ParallelFor(0, 4, 1, [&sum](size_t first, size_t last) { sum += static_cast<int>(last - first); });
+    return inner.get() + sum.load();
+  });
+
+  CPPUNIT_ASSERT_EQUAL(24, outer.get());
+}
+
+void CoffeeMakerThreadPool::testAsyncTaskAndRun() {
+  Task<int()> task([]() { return 42; });
+  Future<int> future = Run<int>([](int value) { return value * 2; }, 21);
+
+  CPPUNIT_ASSERT_EQUAL(42, task.Wait()->Get());
+  CPPUNIT_ASSERT_EQUAL(42, future.get());
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerThreadPool);
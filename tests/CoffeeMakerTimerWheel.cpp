@@ -0,0 +1,112 @@
+#include "CoffeeMakerTimerWheel.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+using namespace CoffeeMaker::Async;
+
+void CoffeeMakerTimerWheel::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void CoffeeMakerTimerWheel::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void CoffeeMakerTimerWheel::testTimeoutFiresOnExpiry() {
+  TimerWheel wheel;
+  int fired = 0;
+  TimerNode node([&fired] { fired++; });
+
+  wheel.Schedule(&node, 100);
+  wheel.Advance(99);
+  CPPUNIT_ASSERT_EQUAL(0, fired);
+  CPPUNIT_ASSERT_EQUAL(static_cast<Uint32>(1), wheel.Remaining(&node));
+  wheel.Advance(1);
+  CPPUNIT_ASSERT_EQUAL(1, fired);
+  CPPUNIT_ASSERT(!node.IsScheduled());
+  wheel.Advance(1000);
+  CPPUNIT_ASSERT_EQUAL(1, fired);
+}
+
+void CoffeeMakerTimerWheel::testCancel() {
+  TimerWheel wheel;
+  int fired = 0;
+  TimerNode node([&fired] { fired++; });
+
+  wheel.Schedule(&node, 50);
+  wheel.Advance(25);
+  wheel.Cancel(&node);
+  wheel.Advance(100);
+  CPPUNIT_ASSERT_EQUAL(0, fired);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), wheel.NumScheduled());
+}
+
+void CoffeeMakerTimerWheel::testInterval() {
+  TimerWheel wheel;
+  int fired = 0;
+  TimerNode node([&fired] { fired++; });
+
+  wheel.Schedule(&node, 300, 300);
+  wheel.Advance(299);
+  CPPUNIT_ASSERT_EQUAL(0, fired);
+  wheel.Advance(1);
+  CPPUNIT_ASSERT_EQUAL(1, fired);
+  wheel.Advance(2700);
+  CPPUNIT_ASSERT_EQUAL(10, fired);
+  CPPUNIT_ASSERT(node.IsScheduled());
+}
+
+void CoffeeMakerTimerWheel::testLongDelayCascade() {
+  TimerWheel wheel;
+  int firedShort = 0;
+  int firedLong = 0;
+  TimerNode shortNode([&firedShort] { firedShort++; });
+  TimerNode longNode([&firedLong] { firedLong++; });
+
+  wheel.Advance(37);
+  wheel.Schedule(&shortNode, 12000);
+  wheel.Schedule(&longNode, 300000);
+  wheel.Advance(11999);
+  CPPUNIT_ASSERT_EQUAL(0, firedShort);
+  wheel.Advance(1);
+  CPPUNIT_ASSERT_EQUAL(1, firedShort);
+  wheel.Advance(300000 - 12001);
+  CPPUNIT_ASSERT_EQUAL(0, firedLong);
+  wheel.Advance(1);
+  CPPUNIT_ASSERT_EQUAL(1, firedLong);
+}
+
+void CoffeeMakerTimerWheel::testPausedUpdate() {
+  TimerWheel wheel;
+  int fired = 0;
+  TimerNode node([&fired] { fired++; });
+
+  wheel.Update(1000);
+  wheel.Schedule(&node, 100);
+  wheel.Update(1050);
+  wheel.Pause();
+  wheel.Update(5000);
+  CPPUNIT_ASSERT_EQUAL(0, fired);
+  CPPUNIT_ASSERT_EQUAL(static_cast<Uint32>(50), wheel.Remaining(&node));
+  wheel.Unpause();
+  wheel.Update(5049);
+  CPPUNIT_ASSERT_EQUAL(0, fired);
+  wheel.Update(5050);
+  CPPUNIT_ASSERT_EQUAL(1, fired);
+}
+
+void CoffeeMakerTimerWheel::testScheduleFromCallback() {
+  TimerWheel wheel;
+  int fired = 0;
+  TimerNode node([&fired] { fired++; });
+  TimerNode rescheduler([&wheel, &node] { wheel.Schedule(&node, 0); });
+
+  wheel.Schedule(&rescheduler, 10);
+  wheel.Advance(10);
+  CPPUNIT_ASSERT_EQUAL(0, fired);
+  wheel.Advance(1);
+  CPPUNIT_ASSERT_EQUAL(1, fired);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerTimerWheel);
@@ -51,6 +51,7 @@ void CoffeeMakerUserEvents::testUserEventsDeletedSelf() {
   };
 
   CPPUNIT_ASSERT_NO_THROW(CoffeeMaker::UserEventHandler::HandleUserEvent(userEvent));
+  CoffeeMaker::UserEventHandler::ClearUserEvents();
   CPPUNIT_ASSERT_EQUAL(expectedListenersPostCall, CoffeeMaker::IUserEventListener::NumListeners());
 }
 
@@ -79,6 +80,7 @@ void CoffeeMakerUserEvents::testUserEventsCreatedMoreListeners() {
   };
 
   CPPUNIT_ASSERT_NO_THROW(CoffeeMaker::UserEventHandler::HandleUserEvent(userEvent));
+  CoffeeMaker::UserEventHandler::ClearUserEvents();
 
   CPPUNIT_ASSERT_EQUAL(expectedListenersPostCall, CoffeeMaker::IUserEventListener::NumListeners());
   CPPUNIT_ASSERT_EQUAL(listener1ExpectedHandledTimes, listener1->NumTimesEventHandled());
@@ -121,6 +123,7 @@ void CoffeeMakerUserEvents::testUserEventsDeletedSubsequentListeners() {
   };
 
   CPPUNIT_ASSERT_NO_THROW(CoffeeMaker::UserEventHandler::HandleUserEvent(userEvent));
+  CoffeeMaker::UserEventHandler::ClearUserEvents();
 
   CPPUNIT_ASSERT_EQUAL(expectedListenersPostCall, CoffeeMaker::IUserEventListener::NumListeners());
   CPPUNIT_ASSERT_EQUAL(listener1ExpectedHandledTimes, listener1ActualHandledTimes);
@@ -128,4 +131,35 @@ void CoffeeMakerUserEvents::testUserEventsDeletedSubsequentListeners() {
   CPPUNIT_ASSERT_EQUAL(listener2And3ExpectedHandledTimes, listener3ActualHandledTimes);
 }
 
+void CoffeeMakerUserEvents::testUserEventsStaleListenersClearedOnce() {
+  CoffeeMaker::UserEventHandler::ClearUserEvents();
+  Scope<CoffeeMakerUserEventImpl> listener1 = CreateScope<CoffeeMakerUserEventImpl>();
+  Scope<CoffeeMakerUserEventImpl> listener2 = CreateScope<CoffeeMakerUserEventImpl>();
+  Scope<CoffeeMakerUserEventImpl> listener3 = CreateScope<CoffeeMakerUserEventImpl>();
+  SDL_UserEvent userEvent{
+      .type = SDL_USEREVENT,
+      .timestamp = 123456,
+      .windowID = 1,
+      .code = 123,
+      .data1 = nullptr,
+      .data2 = nullptr,
+  };
+
+  listener1.reset();
+  CoffeeMaker::UserEventHandler::HandleUserEvent(userEvent);
+  CoffeeMaker::UserEventHandler::HandleUserEvent(userEvent);
+  // NOTE: the destroyed listener keeps its slot until the end of the frame
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), CoffeeMaker::IUserEventListener::NumListeners());
+
+  CoffeeMaker::UserEventHandler::ClearUserEvents();
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), CoffeeMaker::IUserEventListener::NumListeners());
+
+  // NOTE: listener3 moved to a new slot, removing it must clear that slot and not its old one
+  listener3.reset();
+  CoffeeMaker::UserEventHandler::HandleUserEvent(userEvent);
+  CoffeeMaker::UserEventHandler::ClearUserEvents();
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), CoffeeMaker::IUserEventListener::NumListeners());
+  CPPUNIT_ASSERT_EQUAL(3u, listener2->NumTimesEventHandled());
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(CoffeeMakerUserEvents);
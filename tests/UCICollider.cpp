@@ -0,0 +1,57 @@
+#include "UCICollider.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <string>
+#include <vector>
+
+void UCICollider::setUp() { Collider::ClearAllUnprocessedCollisions(); }
+
+void UCICollider::tearDown() { Collider::ClearAllUnprocessedCollisions(); }
+
+void UCICollider::testContactsDispatchInIdOrder() {
+  // NOTE: ids follow construction order, whatever addresses the colliders end up at
+  Collider first(Collider::Type::Default, true);
+  Collider second(Collider::Type::Default, true);
+  Collider third(Collider::Type::Default, true);
+  std::vector<std::string> dispatched;
+  first.OnCollide([&dispatched](Collider*) { dispatched.push_back("first"); });
+  second.OnCollide([&dispatched](Collider*) { dispatched.push_back("second"); });
+  third.OnCollide([&dispatched](Collider*) { dispatched.push_back("third"); });
+
+  Collider::QueueContact(&third, &second);
+  Collider::QueueContact(&second, &first);
+  Collider::QueueContact(&first, &second);
+  Collider::ProcessCollisions();
+
+  const std::vector<std::string> expected{"first", "second", "second", "third"};
+  CPPUNIT_ASSERT(expected == dispatched);
+  CPPUNIT_ASSERT_EQUAL(static_cast<Uint32>(2), Collider::Contacts());
+}
+
+void UCICollider::testListenersAddedDuringDispatchWait() {
+  Collider target(Collider::Type::Default, true);
+  Collider other(Collider::Type::Default, true);
+  int added = 0;
+  int late = 0;
+  target.OnCollide([&target, &added, &late](Collider*) {
+    // NOTE: enough listeners to outgrow the vector being iterated, were they added to it right away
+    for (int i = 0; i < 16; i++) {
+      target.OnCollide([&late](Collider*) { late++; });
+    }
+    added++;
+  });
+
+  Collider::QueueContact(&target, &other);
+  Collider::ProcessCollisions();
+  CPPUNIT_ASSERT_EQUAL(1, added);
+  CPPUNIT_ASSERT_EQUAL(0, late);
+
+  Collider::QueueContact(&target, &other);
+  Collider::ProcessCollisions();
+  CPPUNIT_ASSERT_EQUAL(2, added);
+  CPPUNIT_ASSERT_EQUAL(16, late);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(UCICollider);
@@ -0,0 +1,132 @@
+#include "UCIPathFollowerSystem.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <vector>
+
+namespace {
+  /**
+   * @brief Straight line from (0, 0) to (100, 0), and its twin inverted on a 200 wide screen.
+   */
+  PathFollowerSystem::PathId AddLine() {
+    using Pt2 = CoffeeMaker::Math::Point2D;
+    std::vector<Pt2> points{Pt2{.x = 0, .y = 0}, Pt2{.x = 50, .y = 0}, Pt2{.x = 100, .y = 0}};
+    std::vector<float> lengths = CoffeeMaker::BakedSpline::ArcLengths(points);
+    CoffeeMaker::BakedSpline path(points, lengths);
+    CoffeeMaker::BakedSpline inverted = path.Invert(200.0f);
+    return PathFollowerSystem::AddPath(PathFollowerSystem::Paths{.path = path, .inverted = inverted});
+  }
+}  // namespace
+
+void UCIPathFollowerSystem::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void UCIPathFollowerSystem::tearDown() { PathFollowerSystem::Destroy(); }
+
+void UCIPathFollowerSystem::testFollowersAdvanceTogether() {
+  const PathFollowerSystem::PathId line = AddLine();
+  PathFollowerSystem::FollowerId slow = PathFollowerSystem::Add(line, 2.0f, false, nullptr);
+  PathFollowerSystem::FollowerId fast = PathFollowerSystem::Add(line, 1.0f, true, nullptr);
+  PathFollowerSystem::FollowerId idle = PathFollowerSystem::Add(line, 1.0f, false, nullptr);
+  PathFollowerSystem::Reset(idle);
+  PathFollowerSystem::Start(slow);
+  PathFollowerSystem::Start(fast);
+
+  PathFollowerSystem::Update(0.5f);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(25.0, PathFollowerSystem::Position(slow).x, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(150.0, PathFollowerSystem::Position(fast).x, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, PathFollowerSystem::Position(idle).x, 0.001);
+  CPPUNIT_ASSERT(!PathFollowerSystem::IsRunning(idle));
+
+  // NOTE: anchors move the ends for one follower alone
+  PathFollowerSystem::AnchorEnd(slow, CoffeeMaker::Math::Point2D{.x = 100, .y = 40});
+  PathFollowerSystem::Update(0.5f);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(50.0, PathFollowerSystem::Position(slow).x, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, PathFollowerSystem::Position(slow).y, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, PathFollowerSystem::Position(fast).x, 0.001);
+  CPPUNIT_ASSERT(PathFollowerSystem::IsComplete(fast));
+  CPPUNIT_ASSERT(!PathFollowerSystem::IsRunning(fast));
+  CPPUNIT_ASSERT(!PathFollowerSystem::IsComplete(slow));
+}
+
+void UCIPathFollowerSystem::testCompletionCallbacksRunAfterThePass() {
+  const PathFollowerSystem::PathId line = AddLine();
+  std::vector<PathFollowerSystem::FollowerId> followers;
+  std::vector<float> seen;
+  for (int i = 0; i < 3; i++) {
+    followers.push_back(PathFollowerSystem::Add(line, 1.0f, false, [&followers, &seen]() {
+      // NOTE: every follower was moved before the first callback runs
+      seen.push_back(PathFollowerSystem::Position(followers.back()).x);
+      if (seen.size() == 1) {
+        PathFollowerSystem::Remove(followers.front());
+      }
+    }));
+    PathFollowerSystem::Start(followers.back());
+  }
+
+  PathFollowerSystem::Update(1.0f);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), seen.size());
+  for (float x : seen) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, x, 0.001);
+  }
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), PathFollowerSystem::Count());
+
+  // NOTE: callbacks run once, not every frame past the end
+  PathFollowerSystem::Update(1.0f);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), seen.size());
+}
+
+void UCIPathFollowerSystem::testRemoveKeepsOtherFollowers() {
+  const PathFollowerSystem::PathId line = AddLine();
+  PathFollowerSystem::FollowerId first = PathFollowerSystem::Add(line, 1.0f, false, nullptr);
+  PathFollowerSystem::FollowerId second = PathFollowerSystem::Add(line, 4.0f, false, nullptr);
+  PathFollowerSystem::FollowerId third = PathFollowerSystem::Add(line, 2.0f, false, nullptr);
+  PathFollowerSystem::Start(third);
+  PathFollowerSystem::Remove(first);
+  PathFollowerSystem::Start(second);
+
+  PathFollowerSystem::Update(1.0f);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(25.0, PathFollowerSystem::Position(second).x, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(50.0, PathFollowerSystem::Position(third).x, 0.001);
+
+  // NOTE: the freed index is handed out again, under a new generation
+  PathFollowerSystem::FollowerId fourth = PathFollowerSystem::Add(line, 1.0f, false, nullptr);
+  CPPUNIT_ASSERT_EQUAL(first.index, fourth.index);
+  CPPUNIT_ASSERT(first != fourth);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), PathFollowerSystem::Count());
+}
+
+void UCIPathFollowerSystem::testStaleIdsAreIgnored() {
+  const PathFollowerSystem::PathId line = AddLine();
+  PathFollowerSystem::FollowerId removed = PathFollowerSystem::Add(line, 1.0f, false, nullptr);
+  PathFollowerSystem::Remove(removed);
+  PathFollowerSystem::FollowerId reused = PathFollowerSystem::Add(line, 1.0f, false, nullptr);
+
+  PathFollowerSystem::Start(removed);
+  PathFollowerSystem::AnchorStart(removed, CoffeeMaker::Math::Point2D{.x = 10, .y = 10});
+  PathFollowerSystem::Remove(removed);
+  PathFollowerSystem::Update(0.5f);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), PathFollowerSystem::Count());
+  CPPUNIT_ASSERT(!PathFollowerSystem::IsRunning(reused));
+  CPPUNIT_ASSERT(!PathFollowerSystem::IsRunning(removed));
+  CPPUNIT_ASSERT(!PathFollowerSystem::IsComplete(removed));
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, PathFollowerSystem::Position(reused).x, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, PathFollowerSystem::Position(reused).y, 0.001);
+}
+
+void UCIPathFollowerSystem::testAnchoringSamplesAgain() {
+  const PathFollowerSystem::PathId line = AddLine();
+  PathFollowerSystem::FollowerId follower = PathFollowerSystem::Add(line, 1.0f, false, nullptr);
+  PathFollowerSystem::Start(follower);
+  PathFollowerSystem::Update(0.5f);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, PathFollowerSystem::Position(follower).y, 0.001);
+
+  // NOTE: read between two updates, as the echelon enemies do
+  PathFollowerSystem::AnchorEnd(follower, CoffeeMaker::Math::Point2D{.x = 100, .y = 40});
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(50.0, PathFollowerSystem::Position(follower).x, 0.001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, PathFollowerSystem::Position(follower).y, 0.001);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(UCIPathFollowerSystem);
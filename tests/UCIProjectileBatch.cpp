@@ -0,0 +1,80 @@
+#include "UCIProjectileBatch.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cmath>
+#include <vector>
+
+static const ProjectileBatch::Bounds TEST_BOUNDS{16.0f, 16.0f, 1920.0f, 1080.0f};
+
+void UCIProjectileBatch::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void UCIProjectileBatch::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void UCIProjectileBatch::testMatchesScalar() {
+  // NOTE: 37 is not a multiple of any vector width, so the scalar tail is exercised as well
+  const size_t count = 37;
+  std::vector<float> x(count), y(count), velocityX(count), velocityY(count);
+  std::vector<std::uint8_t> alive(count, 1);
+  unsigned int seed = 11;
+  auto next = [&seed](float min, float max) {
+    seed = seed * 1103515245u + 12345u;
+    return min + (max - min) * static_cast<float>((seed >> 8) & 0xFFFF) / 65535.0f;
+  };
+  for (size_t i = 0; i < count; i++) {
+    x[i] = next(-32.0f, 1952.0f);
+    y[i] = next(-32.0f, 1112.0f);
+    velocityX[i] = next(-2000.0f, 2000.0f);
+    velocityY[i] = next(-2000.0f, 2000.0f);
+  }
+  std::vector<float> scalarX = x, scalarY = y;
+  std::vector<std::uint8_t> scalarAlive = alive;
+
+  for (int frame = 0; frame < 30; frame++) {
+    ProjectileBatch::Integrate(x.data(), y.data(), velocityX.data(), velocityY.data(), alive.data(), count, 0.016f,
+                               TEST_BOUNDS);
+    ProjectileBatch::IntegrateScalar(scalarX.data(), scalarY.data(), velocityX.data(), velocityY.data(),
+                                     scalarAlive.data(), count, 0.016f, TEST_BOUNDS);
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(scalarX[i], x[i], 0.01);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(scalarY[i], y[i], 0.01);
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(scalarAlive[i]), static_cast<int>(alive[i]));
+  }
+}
+
+void UCIProjectileBatch::testOffScreenClearsAlive() {
+  // NOTE: one projectile leaving through each edge, one staying on screen, repeated to fill a full vector
+  std::vector<float> x{100.0f, -10.0f, 1910.0f, 100.0f, 100.0f, 500.0f, 500.0f, 500.0f, 500.0f};
+  std::vector<float> y{100.0f, 100.0f, 100.0f, -10.0f, 1070.0f, 500.0f, 500.0f, 500.0f, 500.0f};
+  std::vector<float> velocityX{0.0f, -100.0f, 100.0f, 0.0f, 0.0f, 10.0f, -10.0f, 0.0f, 0.0f};
+  std::vector<float> velocityY{0.0f, 0.0f, 0.0f, -100.0f, 100.0f, 0.0f, 0.0f, 10.0f, -10.0f};
+  std::vector<std::uint8_t> alive(x.size(), 1);
+
+  ProjectileBatch::Integrate(x.data(), y.data(), velocityX.data(), velocityY.data(), alive.data(), x.size(), 0.1f,
+                             TEST_BOUNDS);
+
+  std::vector<std::uint8_t> expected{1, 0, 0, 0, 0, 1, 1, 1, 1};
+  CPPUNIT_ASSERT(expected == alive);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(501.0, x[5], 0.0001);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(499.0, y[8], 0.0001);
+}
+
+void UCIProjectileBatch::testReloadedStayReloaded() {
+  std::vector<float> x(8, 100.0f), y(8, 100.0f), velocityX(8, 0.0f), velocityY(8, 0.0f);
+  std::vector<std::uint8_t> alive{1, 0, 1, 0, 1, 0, 1, 0};
+
+  ProjectileBatch::Integrate(x.data(), y.data(), velocityX.data(), velocityY.data(), alive.data(), x.size(), 0.016f,
+                             TEST_BOUNDS);
+
+  std::vector<std::uint8_t> expected{1, 0, 1, 0, 1, 0, 1, 0};
+  CPPUNIT_ASSERT(expected == alive);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(UCIProjectileBatch);
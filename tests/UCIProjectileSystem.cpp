@@ -0,0 +1,82 @@
+#include "UCIProjectileSystem.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <vector>
+
+void UCIProjectileSystem::setUp() {
+  // NOTE: no Init, the system runs without textures or sounds
+  ProjectileSystem::Destroy();
+  ProjectileSystem::SetBounds(800.0f, 600.0f);
+}
+
+void UCIProjectileSystem::tearDown() {
+  Collider::ClearAllUnprocessedCollisions();
+  ProjectileSystem::Destroy();
+}
+
+void UCIProjectileSystem::testSpawnIntegrateAndRecycle() {
+  // NOTE: a heading of 0 degrees moves right
+  CPPUNIT_ASSERT(ProjectileSystem::Fire(Collider::Type::Projectile, ProjectileSystem::Type::Friendly,
+                                        ProjectileSystem::Size::Small, 100.0f, 100.0f, 0.0));
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), ProjectileSystem::Count());
+
+  // NOTE: 600px in, still on screen
+  ProjectileSystem::Update(1.0f);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), ProjectileSystem::Count());
+
+  // NOTE: 1100px in, off screen and reloaded
+  ProjectileSystem::Update(1.0f);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), ProjectileSystem::Count());
+}
+
+void UCIProjectileSystem::testFullSystemRejectsSpawn() {
+  for (size_t i = 0; i < ProjectileSystem::MAX_PROJECTILES; i++) {
+    CPPUNIT_ASSERT(ProjectileSystem::FireAt(Collider::Type::EnemyProjectile, ProjectileSystem::Type::Hostile,
+                                            ProjectileSystem::Size::Small, 400.0f, 100.0f, 400.0f, 500.0f, 0.0));
+  }
+  CPPUNIT_ASSERT(!ProjectileSystem::FireAt(Collider::Type::EnemyProjectile, ProjectileSystem::Type::Hostile,
+                                           ProjectileSystem::Size::Small, 400.0f, 100.0f, 400.0f, 500.0f, 0.0));
+  CPPUNIT_ASSERT_EQUAL(ProjectileSystem::MAX_PROJECTILES, ProjectileSystem::Count());
+}
+
+void UCIProjectileSystem::testReloadAllByColliderType() {
+  ProjectileSystem::Fire(Collider::Type::Projectile, ProjectileSystem::Type::Friendly, ProjectileSystem::Size::Small,
+                         100.0f, 100.0f, 0.0);
+  ProjectileSystem::Fire(Collider::Type::Projectile, ProjectileSystem::Type::Friendly, ProjectileSystem::Size::Large,
+                         100.0f, 200.0f, 0.0);
+  ProjectileSystem::FireAt(Collider::Type::EnemyProjectile, ProjectileSystem::Type::Hostile,
+                           ProjectileSystem::Size::Small, 400.0f, 100.0f, 400.0f, 500.0f, 0.0);
+
+  ProjectileSystem::ReloadAll(Collider::Type::Projectile);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), ProjectileSystem::Count());
+}
+
+void UCIProjectileSystem::testHitDispatchesOncePerTarget() {
+  Collider target(Collider::Type::Enemy, true);
+  target.clientRect = SDL_FRect{200.0f, 90.0f, 50.0f, 50.0f};
+  std::vector<Collider::Type> hits;
+  target.OnCollide([&hits](Collider* collider) { hits.push_back(collider->GetType()); });
+  Collider bystander(Collider::Type::Player, true);
+  bystander.clientRect = SDL_FRect{200.0f, 300.0f, 50.0f, 50.0f};
+  int bystanderHits = 0;
+  bystander.OnCollide([&bystanderHits](Collider*) { bystanderHits++; });
+
+  // NOTE: both reach the target within the same update, a friendly projectile never hits the player
+  ProjectileSystem::Fire(Collider::Type::Projectile, ProjectileSystem::Type::Friendly, ProjectileSystem::Size::Small,
+                         150.0f, 100.0f, 0.0);
+  ProjectileSystem::Fire(Collider::Type::Projectile, ProjectileSystem::Type::Friendly, ProjectileSystem::Size::Small,
+                         160.0f, 100.0f, 0.0);
+  ProjectileSystem::Fire(Collider::Type::Projectile, ProjectileSystem::Type::Friendly, ProjectileSystem::Size::Small,
+                         150.0f, 310.0f, 0.0);
+  ProjectileSystem::Update(0.1f);
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), ProjectileSystem::Count());
+
+  Collider::ProcessCollisions();
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), hits.size());
+  CPPUNIT_ASSERT(hits[0] == Collider::Type::Projectile);
+  CPPUNIT_ASSERT_EQUAL(0, bystanderHits);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(UCIProjectileSystem);
@@ -7,6 +7,8 @@
 #include <thread>
 
 #include "Coroutine.hpp"
+#include "EventBus.hpp"
+#include "Executor.hpp"
 #include "Game/Events.hpp"
 #include "Game/ScoreManager.hpp"
 
@@ -21,6 +23,7 @@ void UCIScoreManager::tearDown() {
 void UCIScoreManager::testScoreManagerInit() {
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::Destroy();
 }
 
@@ -38,8 +41,10 @@ void UCIScoreManager::testScoreManagerWriteHighScores() {
 
   c();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::LoadHighScores();
   CPPUNIT_ASSERT_EQUAL(expectedFirstScore, ScoreManager::GetHighScores().firstPlace);
   CPPUNIT_ASSERT_EQUAL(expectedSecondScore, ScoreManager::GetHighScores().secondPlace);
@@ -51,6 +56,7 @@ void UCIScoreManager::testScoreManagerWriteHighScores() {
 void UCIScoreManager::testScoreManagerLoadHighScores() {
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::IncrementScore(500);
   unsigned int expectedScore = 500;
   unsigned int actualScore = ScoreManager::GetScore();
@@ -69,8 +75,10 @@ void UCIScoreManager::testScoreManagerCurrentScorePlacementNoPlacement() {
 
   c();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::LoadHighScores();
   ScoreManager::IncrementScore(999);
   int expectedPlacement = -1;
@@ -91,8 +99,10 @@ void UCIScoreManager::testScoreManagerCurrentScorePlacementThirdPlacement() {
 
   c();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::LoadHighScores();
   ScoreManager::IncrementScore(1001);
   int expectedPlacement = 3;
@@ -113,9 +123,11 @@ void UCIScoreManager::testScoreManagerCurrentScorePlacementSecondPlacement() {
 
   c();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
 
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::LoadHighScores();
   ScoreManager::IncrementScore(2501);
   int expectedPlacement = 2;
@@ -136,8 +148,10 @@ void UCIScoreManager::testScoreManagerCurrentScorePlacementFirstPlacement() {
 
   c();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::LoadHighScores();
   ScoreManager::IncrementScore(5001);
   int expectedPlacement = 1;
@@ -152,6 +166,7 @@ void UCIScoreManager::testScoreManagerCurrentScorePlacementFirstPlacement() {
 void UCIScoreManager::testScoreManagerListensToUserEvent() {
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::LoadHighScores();
   int expectedScore = 10;
 
@@ -164,7 +179,8 @@ void UCIScoreManager::testScoreManagerListensToUserEvent() {
       .data2 = nullptr,
   };
 
-  CoffeeMaker::UserEventHandler::HandleUserEvent(userEvent);
+  CoffeeMaker::EventBus::Instance()->Publish(userEvent);
+  CoffeeMaker::EventBus::ProcessEvents();
 
   int actualScore = ScoreManager::GetScore();
 
@@ -176,6 +192,7 @@ void UCIScoreManager::testScoreManagerListensToUserEvent() {
 void UCIScoreManager::testScoreManagerListensToUserEventWithMultiplier() {
   ScoreManager::Init();
   std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  CoffeeMaker::Async::Executor::ProcessReady();
   ScoreManager::LoadHighScores();
   int expectedScore = 20;
 
@@ -188,7 +205,8 @@ void UCIScoreManager::testScoreManagerListensToUserEventWithMultiplier() {
       .data2 = nullptr,
   };
 
-  CoffeeMaker::UserEventHandler::HandleUserEvent(userEvent);
+  CoffeeMaker::EventBus::Instance()->Publish(userEvent);
+  CoffeeMaker::EventBus::ProcessEvents();
 
   int actualScore = ScoreManager::GetScore();
 
@@ -0,0 +1,103 @@
+#include "UCISpatialGrid.hpp"
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <set>
+#include <utility>
+
+using Pairs = std::set<std::pair<std::uint32_t, std::uint32_t>>;
+
+static Pairs CollectPairs(SpatialGrid& grid, const std::vector<SDL_FRect>& rects) {
+  Pairs pairs;
+  size_t reported = 0;
+  grid.Build(rects.data(), rects.size());
+  grid.ForEachPair([&pairs, &reported](std::uint32_t i, std::uint32_t j) {
+    pairs.insert({i, j});
+    reported++;
+  });
+  CPPUNIT_ASSERT_EQUAL(pairs.size(), reported);
+  return pairs;
+}
+
+void UCISpatialGrid::setUp() {
+  // TODO: Implement set up logic...
+}
+
+void UCISpatialGrid::tearDown() {
+  // TODO: Implement tear down logic...
+}
+
+void UCISpatialGrid::testOverlappingPairReported() {
+  SpatialGrid grid(64.0f);
+  std::vector<SDL_FRect> rects{{10, 10, 32, 32}, {20, 20, 32, 32}};
+  Pairs pairs = CollectPairs(grid, rects);
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), pairs.size());
+  CPPUNIT_ASSERT(pairs.count({0, 1}) == 1);
+}
+
+void UCISpatialGrid::testSeparatedRectsNotReported() {
+  SpatialGrid grid(64.0f);
+  std::vector<SDL_FRect> rects{{0, 0, 32, 32}, {32, 0, 32, 32}, {500, 500, 16, 16}};
+  Pairs pairs = CollectPairs(grid, rects);
+
+  CPPUNIT_ASSERT(pairs.empty());
+}
+
+void UCISpatialGrid::testPairSpanningCellsReportedOnce() {
+  SpatialGrid grid(16.0f);
+  std::vector<SDL_FRect> rects{{0, 0, 100, 100}, {10, 10, 80, 80}, {300, 300, 8, 8}};
+  Pairs pairs = CollectPairs(grid, rects);
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), pairs.size());
+  CPPUNIT_ASSERT(pairs.count({0, 1}) == 1);
+}
+
+void UCISpatialGrid::testMatchesBruteForce() {
+  SpatialGrid grid(128.0f);
+  std::vector<SDL_FRect> rects;
+  unsigned int seed = 7;
+  auto next = [&seed](unsigned int range) {
+    seed = seed * 1103515245u + 12345u;
+    return static_cast<float>((seed >> 8) % range);
+  };
+  for (int i = 0; i < 400; i++) {
+    rects.push_back({next(2560) - 200.0f, next(1440) - 200.0f, 8.0f + next(64), 8.0f + next(64)});
+  }
+
+  Pairs expected;
+  for (std::uint32_t i = 0; i < rects.size(); i++) {
+    for (std::uint32_t j = i + 1; j < rects.size(); j++) {
+      if (SpatialGrid::Overlaps(rects[i], rects[j])) {
+        expected.insert({i, j});
+      }
+    }
+  }
+
+  CPPUNIT_ASSERT(expected == CollectPairs(grid, rects));
+}
+
+void UCISpatialGrid::testLayerMaskSkipsPairs() {
+  SpatialGrid grid(64.0f);
+  // NOTE: two bullets on layer 0b01 that only collide with layer 0b10, and a ship on layer 0b10
+  std::vector<SDL_FRect> rects{{0, 0, 32, 32}, {8, 8, 32, 32}, {16, 16, 32, 32}};
+  std::vector<std::uint32_t> layers{0b01, 0b01, 0b10};
+  std::vector<std::uint32_t> masks{0b10, 0b10, 0b01};
+  Pairs pairs;
+  grid.Build(rects.data(), rects.size(), layers.data(), masks.data());
+  grid.ForEachPair([&pairs](std::uint32_t i, std::uint32_t j) { pairs.insert({i, j}); });
+
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), pairs.size());
+  CPPUNIT_ASSERT(pairs.count({0, 1}) == 0);
+  CPPUNIT_ASSERT(pairs.count({0, 2}) == 1);
+  CPPUNIT_ASSERT(pairs.count({1, 2}) == 1);
+
+  // NOTE: layers without masks filter nothing
+  pairs.clear();
+  grid.Build(rects.data(), rects.size(), layers.data());
+  grid.ForEachPair([&pairs](std::uint32_t i, std::uint32_t j) { pairs.insert({i, j}); });
+  CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), pairs.size());
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(UCISpatialGrid);
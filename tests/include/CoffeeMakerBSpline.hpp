@@ -15,6 +15,10 @@ class CoffeeMakerBSpline : public CppUnit::TestFixture {
   CPPUNIT_TEST(testSetBSplineVector2DControlPoints);
   CPPUNIT_TEST(testSetBSplinePoint2DControlPoints);
   CPPUNIT_TEST(testSetBSplinePoint2DAtKnot);
+  CPPUNIT_TEST(testPoint2DAtKnotFollowsControlPoints);
+  CPPUNIT_TEST(testPoint2DAtDistanceMovesAtConstantSpeed);
+  CPPUNIT_TEST(testBakedSplineAnchorsEachFollower);
+  CPPUNIT_TEST(testSplineAssetRoundTrip);
   CPPUNIT_TEST(testSetBSplinePointAddControlPoint);
   // CPPUNIT_TEST(testSetBSplinePointRemoveControlPoint);
   CPPUNIT_TEST_SUITE_END();
@@ -34,6 +38,10 @@ class CoffeeMakerBSpline : public CppUnit::TestFixture {
   // void testSetBSplinePointRemoveControlPoint();
 
   void testSetBSplinePoint2DAtKnot();
+  void testPoint2DAtKnotFollowsControlPoints();
+  void testPoint2DAtDistanceMovesAtConstantSpeed();
+  void testBakedSplineAnchorsEachFollower();
+  void testSplineAssetRoundTrip();
 };
 
 #endif
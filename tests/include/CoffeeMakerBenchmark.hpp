@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakerbenchmark_hpp
+#define _coffeemaker_coffeemakerbenchmark_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Benchmark.hpp"
+
+class CoffeeMakerBenchmark : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerBenchmark);
+  CPPUNIT_TEST(testPercentile);
+  CPPUNIT_TEST(testSummarize);
+  CPPUNIT_TEST(testRecordsRequestedFrames);
+  CPPUNIT_TEST(testScriptedInput);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testPercentile();
+  void testSummarize();
+  void testRecordsRequestedFrames();
+  void testScriptedInput();
+};
+
+#endif
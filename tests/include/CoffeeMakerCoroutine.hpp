@@ -10,6 +10,9 @@ class CoffeeMakerCoroutine : public CppUnit::TestFixture {
   CPPUNIT_TEST(testCoroutineCreation);
   CPPUNIT_TEST(testCoroutineAwaiter);
   CPPUNIT_TEST(testCoroutineReadFileAwaiter);
+  CPPUNIT_TEST(testDelayPausesWithTheTimerWheel);
+  CPPUNIT_TEST(testClearCancelsDelay);
+  CPPUNIT_TEST(testClearCancelsReadFile);
   CPPUNIT_TEST_SUITE_END();
 
   public:
@@ -18,6 +21,9 @@ class CoffeeMakerCoroutine : public CppUnit::TestFixture {
   void testCoroutineCreation();
   void testCoroutineAwaiter();
   void testCoroutineReadFileAwaiter();
+  void testDelayPausesWithTheTimerWheel();
+  void testClearCancelsDelay();
+  void testClearCancelsReadFile();
 };
 
 #endif
@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakercoroutinescheduler_hpp
+#define _coffeemaker_coffeemakercoroutinescheduler_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "CoroutineScheduler.hpp"
+
+class CoffeeMakerCoroutineScheduler : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerCoroutineScheduler);
+  CPPUNIT_TEST(testNextFrameResumesOnTheNextUpdate);
+  CPPUNIT_TEST(testSecondsSkipsPausedTime);
+  CPPUNIT_TEST(testUntilAndEvent);
+  CPPUNIT_TEST(testClearDestroysWaitingScripts);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testNextFrameResumesOnTheNextUpdate();
+  void testSecondsSkipsPausedTime();
+  void testUntilAndEvent();
+  void testClearDestroysWaitingScripts();
+};
+
+#endif
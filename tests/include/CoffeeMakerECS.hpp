@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakerecs_hpp
+#define _coffeemaker_coffeemakerecs_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ECS/World.hpp"
+
+class CoffeeMakerECS : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerECS);
+  CPPUNIT_TEST(testDestroyedHandlesStopResolving);
+  CPPUNIT_TEST(testRemovingKeepsComponentsPacked);
+  CPPUNIT_TEST(testEachVisitsEntitiesWithBothComponents);
+  CPPUNIT_TEST(testDestroyWhileIteratingIsDeferred);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testDestroyedHandlesStopResolving();
+  void testRemovingKeepsComponentsPacked();
+  void testEachVisitsEntitiesWithBothComponents();
+  void testDestroyWhileIteratingIsDeferred();
+};
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakereventbus_hpp
+#define _coffeemaker_coffeemakereventbus_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "EventBus.hpp"
+
+class CoffeeMakerEventBus : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerEventBus);
+  CPPUNIT_TEST(testEventsAreDeliveredOnDispatch);
+  CPPUNIT_TEST(testRoutedEventsOnlyReachTheirTarget);
+  CPPUNIT_TEST(testEventsPublishedWhileDispatchingWaitAFrame);
+  CPPUNIT_TEST(testUnsubscribeWhileDispatching);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testEventsAreDeliveredOnDispatch();
+  void testRoutedEventsOnlyReachTheirTarget();
+  void testEventsPublishedWhileDispatchingWaitAFrame();
+  void testUnsubscribeWhileDispatching();
+};
+
+#endif
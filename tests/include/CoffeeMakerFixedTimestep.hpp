@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakerfixedtimestep_hpp
+#define _coffeemaker_coffeemakerfixedtimestep_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "FixedTimestep.hpp"
+
+class CoffeeMakerFixedTimestep : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerFixedTimestep);
+  CPPUNIT_TEST(testAccumulatesWholeSteps);
+  CPPUNIT_TEST(testSpikeIsSplitIntoSteps);
+  CPPUNIT_TEST(testStepsAreCapped);
+  CPPUNIT_TEST(testInterpolatedPoint);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testAccumulatesWholeSteps();
+  void testSpikeIsSplitIntoSteps();
+  void testStepsAreCapped();
+  void testInterpolatedPoint();
+};
+
+#endif
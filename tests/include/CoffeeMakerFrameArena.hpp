@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakerframearena_hpp
+#define _coffeemaker_coffeemakerframearena_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "FrameArena.hpp"
+
+class CoffeeMakerFrameArena : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerFrameArena);
+  CPPUNIT_TEST(testAllocationsAreAligned);
+  CPPUNIT_TEST(testResetReusesMemory);
+  CPPUNIT_TEST(testOverflowGrowsOnReset);
+  CPPUNIT_TEST(testArenaAllocator);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testAllocationsAreAligned();
+  void testResetReusesMemory();
+  void testOverflowGrowsOnReset();
+  void testArenaAllocator();
+};
+
+#endif
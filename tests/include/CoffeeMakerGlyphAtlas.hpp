@@ -0,0 +1,29 @@
+#ifndef _coffeemaker_coffeemakerglyphatlas_hpp
+#define _coffeemaker_coffeemakerglyphatlas_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "GlyphAtlas.hpp"
+
+class CoffeeMakerGlyphAtlas : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerGlyphAtlas);
+  CPPUNIT_TEST(testBreakLinesWithoutWrapLength);
+  CPPUNIT_TEST(testBreakLinesAtNewlines);
+  CPPUNIT_TEST(testBreakLinesWrapsAtLastSpace);
+  CPPUNIT_TEST(testBreakLinesSplitsLongWords);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testBreakLinesWithoutWrapLength();
+  void testBreakLinesAtNewlines();
+  void testBreakLinesWrapsAtLastSpace();
+  void testBreakLinesSplitsLongWords();
+
+  private:
+  int _advances[256];
+};
+
+#endif
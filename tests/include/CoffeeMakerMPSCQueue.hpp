@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakermpscqueue_hpp
+#define _coffeemaker_coffeemakermpscqueue_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "MPSCQueue.hpp"
+
+class CoffeeMakerMPSCQueue : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerMPSCQueue);
+  CPPUNIT_TEST(testPushAndPopInOrder);
+  CPPUNIT_TEST(testFullRingSpillsIntoOverflow);
+  CPPUNIT_TEST(testDrainLeavesMessagesPushedWhileDraining);
+  CPPUNIT_TEST(testManyProducers);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testPushAndPopInOrder();
+  void testFullRingSpillsIntoOverflow();
+  void testDrainLeavesMessagesPushedWhileDraining();
+  void testManyProducers();
+};
+
+#endif
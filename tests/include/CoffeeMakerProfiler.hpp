@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakerprofiler_hpp
+#define _coffeemaker_coffeemakerprofiler_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Profiler.hpp"
+
+class CoffeeMakerProfiler : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerProfiler);
+  CPPUNIT_TEST(testNestedZonesAreAggregated);
+  CPPUNIT_TEST(testZonesFromOtherThreads);
+  CPPUNIT_TEST(testFullRingDropsEvents);
+  CPPUNIT_TEST(testChromeTrace);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testNestedZonesAreAggregated();
+  void testZonesFromOtherThreads();
+  void testFullRingDropsEvents();
+  void testChromeTrace();
+};
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef _coffeemaker_coffeemakerrenderer_hpp
+#define _coffeemaker_coffeemakerrenderer_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Renderer.hpp"
+#include "Texture.hpp"
+
+class CoffeeMakerRenderer : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerRenderer);
+  CPPUNIT_TEST(testOpaqueSpriteQueuesWhiteVertices);
+  CPPUNIT_TEST(testTranslucentSpriteQueuesTintedVertices);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testOpaqueSpriteQueuesWhiteVertices();
+  void testTranslucentSpriteQueuesTintedVertices();
+
+  private:
+  /**
+   * @brief Never handed to SDL as a real texture, zeroed so SDL's texture checks reject it.
+   */
+  alignas(16) unsigned char _handle[512];
+  Ref<CoffeeMaker::TextureAsset> _asset;
+};
+
+#endif
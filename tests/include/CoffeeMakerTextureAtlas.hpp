@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakertextureatlas_hpp
+#define _coffeemaker_coffeemakertextureatlas_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "TextureAtlas.hpp"
+
+class CoffeeMakerTextureAtlas : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerTextureAtlas);
+  CPPUNIT_TEST(testPackedRegionsDoNotOverlap);
+  CPPUNIT_TEST(testOversizedImagesAreSkipped);
+  CPPUNIT_TEST(testOverflowStartsNewPage);
+  CPPUNIT_TEST(testFindUnknownName);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testPackedRegionsDoNotOverlap();
+  void testOversizedImagesAreSkipped();
+  void testOverflowStartsNewPage();
+  void testFindUnknownName();
+};
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_coffeemakerthreadpool_hpp
+#define _coffeemaker_coffeemakerthreadpool_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ThreadPool.hpp"
+
+class CoffeeMakerThreadPool : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerThreadPool);
+  CPPUNIT_TEST(testEnqueueReturnsResult);
+  CPPUNIT_TEST(testParallelForVisitsEveryIndexOnce);
+  CPPUNIT_TEST(testNestedWaitDoesNotDeadlock);
+  CPPUNIT_TEST(testAsyncTaskAndRun);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testEnqueueReturnsResult();
+  void testParallelForVisitsEveryIndexOnce();
+  void testNestedWaitDoesNotDeadlock();
+  void testAsyncTaskAndRun();
+};
+
+#endif
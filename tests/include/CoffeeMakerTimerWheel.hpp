@@ -0,0 +1,30 @@
+#ifndef _coffeemaker_coffeemakertimerwheel_hpp
+#define _coffeemaker_coffeemakertimerwheel_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "TimerWheel.hpp"
+
+class CoffeeMakerTimerWheel : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(CoffeeMakerTimerWheel);
+  CPPUNIT_TEST(testTimeoutFiresOnExpiry);
+  CPPUNIT_TEST(testCancel);
+  CPPUNIT_TEST(testInterval);
+  CPPUNIT_TEST(testLongDelayCascade);
+  CPPUNIT_TEST(testPausedUpdate);
+  CPPUNIT_TEST(testScheduleFromCallback);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testTimeoutFiresOnExpiry();
+  void testCancel();
+  void testInterval();
+  void testLongDelayCascade();
+  void testPausedUpdate();
+  void testScheduleFromCallback();
+};
+
+#endif
@@ -40,6 +40,7 @@ class CoffeeMakerUserEvents : public CppUnit::TestFixture {
   CPPUNIT_TEST(testUserEventsDeletedSelf);
   CPPUNIT_TEST(testUserEventsCreatedMoreListeners);
   CPPUNIT_TEST(testUserEventsDeletedSubsequentListeners);
+  CPPUNIT_TEST(testUserEventsStaleListenersClearedOnce);
   CPPUNIT_TEST_SUITE_END();
 
   public:
@@ -49,6 +50,7 @@ class CoffeeMakerUserEvents : public CppUnit::TestFixture {
   void testUserEventsDeletedSelf();
   void testUserEventsCreatedMoreListeners();
   void testUserEventsDeletedSubsequentListeners();
+  void testUserEventsStaleListenersClearedOnce();
 };
 
 #endif
@@ -0,0 +1,22 @@
+#ifndef _coffeemaker_ucicollider_hpp
+#define _coffeemaker_ucicollider_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Game/Collider.hpp"
+
+class UCICollider : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(UCICollider);
+  CPPUNIT_TEST(testContactsDispatchInIdOrder);
+  CPPUNIT_TEST(testListenersAddedDuringDispatchWait);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testContactsDispatchInIdOrder();
+  void testListenersAddedDuringDispatchWait();
+};
+
+#endif
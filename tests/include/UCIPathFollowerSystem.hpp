@@ -0,0 +1,28 @@
+#ifndef _coffeemaker_ucipathfollowersystem_hpp
+#define _coffeemaker_ucipathfollowersystem_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Game/PathFollowerSystem.hpp"
+
+class UCIPathFollowerSystem : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(UCIPathFollowerSystem);
+  CPPUNIT_TEST(testFollowersAdvanceTogether);
+  CPPUNIT_TEST(testCompletionCallbacksRunAfterThePass);
+  CPPUNIT_TEST(testRemoveKeepsOtherFollowers);
+  CPPUNIT_TEST(testStaleIdsAreIgnored);
+  CPPUNIT_TEST(testAnchoringSamplesAgain);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testFollowersAdvanceTogether();
+  void testCompletionCallbacksRunAfterThePass();
+  void testRemoveKeepsOtherFollowers();
+  void testStaleIdsAreIgnored();
+  void testAnchoringSamplesAgain();
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef _coffeemaker_uciprojectilebatch_hpp
+#define _coffeemaker_uciprojectilebatch_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Game/ProjectileBatch.hpp"
+
+class UCIProjectileBatch : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(UCIProjectileBatch);
+  CPPUNIT_TEST(testMatchesScalar);
+  CPPUNIT_TEST(testOffScreenClearsAlive);
+  CPPUNIT_TEST(testReloadedStayReloaded);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testMatchesScalar();
+  void testOffScreenClearsAlive();
+  void testReloadedStayReloaded();
+};
+
+#endif
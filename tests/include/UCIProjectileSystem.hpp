@@ -0,0 +1,26 @@
+#ifndef _coffeemaker_uciprojectilesystem_hpp
+#define _coffeemaker_uciprojectilesystem_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Game/ProjectileSystem.hpp"
+
+class UCIProjectileSystem : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(UCIProjectileSystem);
+  CPPUNIT_TEST(testSpawnIntegrateAndRecycle);
+  CPPUNIT_TEST(testFullSystemRejectsSpawn);
+  CPPUNIT_TEST(testReloadAllByColliderType);
+  CPPUNIT_TEST(testHitDispatchesOncePerTarget);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testSpawnIntegrateAndRecycle();
+  void testFullSystemRejectsSpawn();
+  void testReloadAllByColliderType();
+  void testHitDispatchesOncePerTarget();
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef _coffeemaker_ucispatialgrid_hpp
+#define _coffeemaker_ucispatialgrid_hpp
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Game/SpatialGrid.hpp"
+
+class UCISpatialGrid : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(UCISpatialGrid);
+  CPPUNIT_TEST(testOverlappingPairReported);
+  CPPUNIT_TEST(testSeparatedRectsNotReported);
+  CPPUNIT_TEST(testPairSpanningCellsReportedOnce);
+  CPPUNIT_TEST(testMatchesBruteForce);
+  CPPUNIT_TEST(testLayerMaskSkipsPairs);
+  CPPUNIT_TEST_SUITE_END();
+
+  public:
+  void setUp();
+  void tearDown();
+  void testOverlappingPairReported();
+  void testSeparatedRectsNotReported();
+  void testPairSpanningCellsReportedOnce();
+  void testMatchesBruteForce();
+  void testLayerMaskSkipsPairs();
+};
+
+#endif
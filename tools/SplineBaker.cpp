@@ -0,0 +1,91 @@
+/**
+ * Build time converter from the text .spline assets to the binary .bspline format read by BSpline::LoadBaked.
+ * Evaluates every curve once, here, instead of every time the game starts.
+ *
+ * Usage: CoffeeMakerSplineBaker <outputDirectory> <file.spline>...
+ */
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BakedSpline.hpp"
+#include "Spline.hpp"
+#include "tinysplinecxx.h"
+
+namespace {
+  /**
+   * @brief Reads the whitespace separated x y pairs of a .spline file, see BSpline::Load
+   */
+  bool ReadControlPoints(const std::filesystem::path& filePath, std::vector<tinyspline::real>& controlPoints) {
+    std::ifstream inf{filePath};
+    if (!inf) {
+      return false;
+    }
+    tinyspline::real value;
+    while (inf >> value) {
+      controlPoints.push_back(value);
+    }
+    return inf.eof() && controlPoints.size() >= 2 && controlPoints.size() % 2 == 0;
+  }
+
+  /**
+   * @brief Samples the curve at the same evenly spaced knots as BSpline::BakeArcLength.
+   */
+  CoffeeMaker::SplineAsset Bake(const std::vector<tinyspline::real>& controlPoints, size_t samples) {
+    tinyspline::BSpline spline(controlPoints.size() / 2);
+    spline.setControlPoints(controlPoints);
+
+    CoffeeMaker::SplineAsset asset;
+    for (size_t i = 0; i < controlPoints.size(); i += 2) {
+      asset.controlPoints.push_back(CoffeeMaker::Math::Point2D{.x = static_cast<float>(controlPoints[i]),
+                                                               .y = static_cast<float>(controlPoints[i + 1])});
+    }
+    for (tinyspline::real knot : spline.knots()) {
+      asset.knots.push_back(static_cast<float>(knot));
+    }
+    std::vector<CoffeeMaker::Math::Point2D> points(samples + 1);
+    for (size_t i = 0; i <= samples; i++) {
+      std::vector<tinyspline::real> point =
+          spline.eval(static_cast<tinyspline::real>(i) / static_cast<tinyspline::real>(samples)).result();
+      points[i] = CoffeeMaker::Math::Point2D{.x = static_cast<float>(point[0]), .y = static_cast<float>(point[1])};
+    }
+    std::vector<float> lengths = CoffeeMaker::BakedSpline::ArcLengths(points);
+    asset.path = CoffeeMaker::BakedSpline(std::move(points), std::move(lengths));
+    return asset;
+  }
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::cerr << "Usage: CoffeeMakerSplineBaker <outputDirectory> <file.spline>..." << std::endl;
+    return 1;
+  }
+  const std::filesystem::path outputDirectory(argv[1]);
+  std::error_code error;
+  std::filesystem::create_directories(outputDirectory, error);
+  if (error) {
+    std::cerr << "Could not create " << outputDirectory << ": " << error.message() << std::endl;
+    return 1;
+  }
+
+  for (int i = 2; i < argc; i++) {
+    const std::filesystem::path input(argv[i]);
+    std::vector<tinyspline::real> controlPoints;
+    if (!ReadControlPoints(input, controlPoints)) {
+      std::cerr << "Could not read control points from " << input << std::endl;
+      return 1;
+    }
+    const std::string bytes = Bake(controlPoints, CoffeeMaker::BSpline::ARC_LENGTH_SAMPLES).Encode();
+    const std::filesystem::path output =
+        outputDirectory / input.filename().replace_extension(CoffeeMaker::SplineAsset::EXTENSION);
+    std::ofstream outf{output, std::ios::binary | std::ios::trunc};
+    if (!outf.write(bytes.data(), static_cast<std::streamsize>(bytes.size()))) {
+      std::cerr << "Could not write " << output << std::endl;
+      return 1;
+    }
+    std::cout << "Baked " << input.filename() << " into " << output << " (" << bytes.size() << " bytes)" << std::endl;
+  }
+  return 0;
+}